@@ -0,0 +1,232 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Set of small integers (symbol ids, variable numbers), stored one bit per id
+// in 64 bit words. Only the nonzero words are kept, sorted by position, so a
+// set costs memory for what is in it rather than for the largest id: a
+// function with thousands of variables still has tiny per-block live sets.
+// Sets of any size can be mixed.
+class BitSet {
+ public:
+  BitSet() = default;
+  // set with every id below size
+  static BitSet full(size_t size) {
+    BitSet set;
+    for (size_t i = 0; i < size / 64; ++i) set.chunks.push_back(Chunk { i, ~uint64_t(0) });
+    if (size % 64) set.chunks.push_back(Chunk { size / 64, (uint64_t(1) << (size % 64)) - 1 });
+    return set;
+  }
+
+  bool test(size_t i) const {
+    auto it = find(i / 64);
+    return it != chunks.end() && it->index == i / 64 && (it->bits >> (i % 64)) & 1;
+  }
+  bool count(size_t i) const { return test(i); }
+
+  void insert(size_t i) {
+    uint64_t bit = uint64_t(1) << (i % 64);
+    // sets are mostly built in increasing order
+    if (chunks.empty() || chunks.back().index < i / 64) {
+      chunks.push_back(Chunk { i / 64, bit });
+      return;
+    }
+    auto it = find(i / 64);
+    if (it->index == i / 64) {
+      it->bits |= bit;
+    } else {
+      chunks.insert(it, Chunk { i / 64, bit });
+    }
+  }
+
+  void erase(size_t i) {
+    auto it = find(i / 64);
+    if (it == chunks.end() || it->index != i / 64) return;
+    it->bits &= ~(uint64_t(1) << (i % 64));
+    if (it->bits == 0) chunks.erase(it);
+  }
+
+  void clear() { chunks.clear(); }
+  bool empty() const { return chunks.empty(); }
+
+  size_t size() const {
+    size_t n = 0;
+    for (const Chunk &c : chunks) n += __builtin_popcountll(c.bits);
+    return n;
+  }
+
+  // this |= other, returns true if anything was added
+  bool merge(const BitSet &other) {
+    // most merges in a dataflow pass add nothing, find out without copying
+    bool grows = false; // other has words this doesn't
+    bool changed = false;
+    auto a = chunks.begin();
+    for (const Chunk &c : other.chunks) {
+      while (a != chunks.end() && a->index < c.index) ++a;
+      if (a == chunks.end() || a->index != c.index) {
+        grows = changed = true;
+        break;
+      }
+      changed |= (c.bits & ~a->bits) != 0;
+    }
+    if (!changed) return false;
+
+    if (!grows) {
+      a = chunks.begin();
+      for (const Chunk &c : other.chunks) {
+        while (a->index < c.index) ++a;
+        a->bits |= c.bits;
+      }
+      return true;
+    }
+
+    std::vector<Chunk> &result = scratch();
+    result.clear();
+    unite(chunks, other.chunks, result);
+    chunks.swap(result);
+    return true;
+  }
+
+  // this -= other
+  void subtract(const BitSet &other) {
+    auto b = other.chunks.begin();
+    auto out = chunks.begin();
+    for (const Chunk &c : chunks) {
+      while (b != other.chunks.end() && b->index < c.index) ++b;
+      uint64_t bits = c.bits;
+      if (b != other.chunks.end() && b->index == c.index) bits &= ~b->bits;
+      if (bits) *out++ = Chunk { c.index, bits };
+    }
+    chunks.erase(out, chunks.end());
+  }
+
+  // this &= other
+  void intersect(const BitSet &other) {
+    auto b = other.chunks.begin();
+    auto out = chunks.begin();
+    for (const Chunk &c : chunks) {
+      while (b != other.chunks.end() && b->index < c.index) ++b;
+      if (b == other.chunks.end()) break;
+      uint64_t bits = b->index == c.index ? c.bits & b->bits : 0;
+      if (bits) *out++ = Chunk { c.index, bits };
+    }
+    chunks.erase(out, chunks.end());
+  }
+
+  // this = gen | (in & ~kill), the usual gen/kill transfer function. Returns
+  // true if this changed.
+  bool transfer(const BitSet &gen, const BitSet &in, const BitSet &kill) {
+    std::vector<Chunk> &live = scratch();
+    live.clear();
+    auto k = kill.chunks.begin();
+    for (const Chunk &c : in.chunks) {
+      while (k != kill.chunks.end() && k->index < c.index) ++k;
+      uint64_t bits = c.bits;
+      if (k != kill.chunks.end() && k->index == c.index) bits &= ~k->bits;
+      if (bits) live.push_back(Chunk { c.index, bits });
+    }
+
+    // compare gen | live against this without building it
+    size_t n = 0;
+    bool same = true;
+    auto g = gen.chunks.begin();
+    auto l = live.begin();
+    while (same && (g != gen.chunks.end() || l != live.end())) {
+      Chunk c;
+      if (l == live.end() || (g != gen.chunks.end() && g->index < l->index)) {
+        c = *g++;
+      } else if (g == gen.chunks.end() || l->index < g->index) {
+        c = *l++;
+      } else {
+        c = Chunk { g->index, g->bits | l->bits };
+        ++g, ++l;
+      }
+      same = n < chunks.size() && chunks[n].index == c.index && chunks[n].bits == c.bits;
+      ++n;
+    }
+    if (same && n == chunks.size()) return false;
+
+    std::vector<Chunk> result;
+    unite(gen.chunks, live, result);
+    chunks.swap(result);
+    return true;
+  }
+
+  bool intersects(const BitSet &other) const {
+    auto a = chunks.begin(), b = other.chunks.begin();
+    while (a != chunks.end() && b != other.chunks.end()) {
+      if (a->index < b->index) {
+        ++a;
+      } else if (b->index < a->index) {
+        ++b;
+      } else {
+        if (a->bits & b->bits) return true;
+        ++a, ++b;
+      }
+    }
+    return false;
+  }
+
+  // zero words are never kept, so equal sets have equal chunks
+  bool operator==(const BitSet &other) const {
+    if (chunks.size() != other.chunks.size()) return false;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      if (chunks[i].index != other.chunks[i].index || chunks[i].bits != other.chunks[i].bits) return false;
+    }
+    return true;
+  }
+  bool operator!=(const BitSet &other) const { return !(*this == other); }
+
+  // Call fn(i) for every i in the set, in increasing order
+  template <typename Fn>
+  void for_each(Fn fn) const {
+    for (const Chunk &c : chunks) {
+      uint64_t w = c.bits;
+      while (w) {
+        fn(c.index * 64 + __builtin_ctzll(w));
+        w &= w - 1;
+      }
+    }
+  }
+
+ private:
+  struct Chunk {
+    size_t index; // word position, the bits are ids [64 * index, 64 * index + 64)
+    uint64_t bits; // never zero
+  };
+
+  // first chunk at or after word position index
+  std::vector<Chunk>::iterator find(size_t index) {
+    return std::lower_bound(chunks.begin(), chunks.end(), index,
+        [](const Chunk &c, size_t i) { return c.index < i; });
+  }
+  std::vector<Chunk>::const_iterator find(size_t index) const {
+    return std::lower_bound(chunks.begin(), chunks.end(), index,
+        [](const Chunk &c, size_t i) { return c.index < i; });
+  }
+
+  // out = a | b
+  static void unite(const std::vector<Chunk> &a, const std::vector<Chunk> &b, std::vector<Chunk> &out) {
+    out.reserve(a.size() + b.size());
+    auto i = a.begin(), j = b.begin();
+    while (i != a.end() || j != b.end()) {
+      if (j == b.end() || (i != a.end() && i->index < j->index)) {
+        out.push_back(*i++);
+      } else if (i == a.end() || j->index < i->index) {
+        out.push_back(*j++);
+      } else {
+        out.push_back(Chunk { i->index, i->bits | j->bits });
+        ++i, ++j;
+      }
+    }
+  }
+
+  // reusable buffer for building a set before swapping it in
+  static std::vector<Chunk> &scratch() {
+    static thread_local std::vector<Chunk> buffer;
+    return buffer;
+  }
+
+  std::vector<Chunk> chunks;
+};
@@ -1,148 +1,232 @@
 #include "CFG.h"
-#include <iostream>
 #include <algorithm>
+#include <stdexcept>
 
-bool Program::IsGlobal(const std::string &var) const {
-  if (var.empty() || var[0] == '$' || isdigit(var[0])) {
-    return false;
-  }
+void Program::IndexGlobals() {
+  useCount.assign(names.size(), 0);
+  globals.clear();
+  functionIndex.clear();
+  for (Function *f : functions) functionIndex[f->name] = f;
 
-  int cnt = 0;
   for (Function *f : functions) {
-    if (f->IsVariableUsed(var)) {
-      ++cnt;
+    // count each variable once per function that uses it
+    std::vector<bool> used(f->symbols.size());
+    for (const Block &b : f->blocks) {
+      for (const IRInstruction &ins : b.ins) {
+        auto count = [&](Sym arg) {
+          if (arg == NO_SYM || used[arg]) return;
+          SymKind kind = f->symbols.kind(arg);
+          if (kind != SymKind::local_int && kind != SymKind::local_float && kind != SymKind::global) return;
+          used[arg] = true;
+
+          const std::string &var = f->symbols.name(arg);
+          if (var[0] == '$' || isdigit(var[0])) return; // temporaries are never shared
+          int id = f->symbols.nameId(arg);
+          if (++useCount[id] > 1) {
+            globals.insert(id);
+          }
+        };
+        for (Sym arg : { ins.arg1, ins.arg2, ins.arg3 }) count(arg);
+        for (Sym arg : ins.more) count(arg); // call arguments past the third
+      }
     }
   }
-  return cnt > 1;
 }
 
 std::vector<std::string> Program::GetGlobalInts() const {
   std::vector<std::string> out;
+  BitSet seen;
   for (Function *f : functions) {
-    for (const std::string &s : f->intlist) {
-      if (IsGlobal(s)) {
-        if (std::find(out.begin(), out.end(), s) == out.end()) {
-          out.push_back(s);
-        }
+    for (Sym sym : f->intlist) {
+      int id = f->symbols.nameId(sym);
+      if (globals.test(id) && !seen.test(id)) {
+        seen.insert(id);
+        out.push_back(names.str(id));
       }
     }
   }
   return out;
 }
 
-bool Function::isInt(const std::string &var) const {
-  return std::find(intlist.begin(), intlist.end(), var) != intlist.end();
-}
-
-bool Function::isFloat(const std::string &var) const {
-  return std::find(floatlist.begin(), floatlist.end(), var) != floatlist.end();
-}
-
-bool Function::isVar(const std::string &var) const {
-  return isInt(var) || isFloat(var);
-}
-
-bool Function::IsVariableUsed(const std::string &var) const {
-  // for extra fun, functions will use variables not in their int-list
-  // which is what means that it is a global variable
-  
-  Block *b = start;
-  while (b != nullptr) {
-    for (const IRInstruction &ins : b->ins) {
-      if (ins.arg1 == var || ins.arg2 == var || ins.arg3 == var) {
-        return true;
+std::vector<std::pair<std::string, int>> Program::GetArrays() const {
+  std::vector<std::pair<std::string, int>> out;
+  std::unordered_map<int, size_t> seen; // name id -> index in out
+  for (Function *f : functions) {
+    for (auto [array, length] : f->arrays) {
+      int id = f->symbols.nameId(array);
+      auto it = seen.find(id);
+      if (it == seen.end()) {
+        seen[id] = out.size();
+        out.emplace_back(names.str(id), length);
+      } else {
+        out[it->second].second = std::max(out[it->second].second, length);
       }
     }
-    b = b->after;
   }
-
-  return false;
-}
-
-static Block *find_block(const std::vector<Block *> &blocks, const std::string &name) {
-  for (Block *block : blocks) {
-    if (block->label == name) {
-      return block;
-    }
-  }
-  return nullptr;
+  return out;
 }
 
-Block *createCfg(const std::vector<IRInstruction> &instructions) {
-  Block *block = nullptr;
-  std::vector<Block *> blocks;
+void createCfg(Function *function, const std::vector<IRInstruction> &instructions) {
+  std::vector<Block> &blocks = function->blocks;
+  blocks.clear();
   bool newBlock = false;
 
   for (const IRInstruction &instruction : instructions) {
-    if (block == nullptr) {
-      // first block. assumed to have a label.
-      block = new Block(instruction.label);
-    } else if (instruction.Label() || newBlock) {
-      blocks.push_back(block);
-      Block *prev = block;
-      block = new Block(instruction.label);
-      prev->after = block;
+    if (blocks.empty() || instruction.Label() || newBlock) {
+      // first block is assumed to have a label
+      blocks.emplace_back(blocks.size(), instruction.label);
       newBlock = false;
     }
 
-    block->ins.push_back(instruction);
+    blocks.back().ins.push_back(instruction);
 
     if (instruction.Terminal()) {
       newBlock = true;
     }
   }
 
-  blocks.push_back(block);
-
-  int cnt = 0;
-  for (Block *b : blocks) {
-    std::cout << "Block " << (++cnt) << std::endl;
-    for (const IRInstruction &i : b->ins)
-      std::cout << i << std::endl;
+  // label -> block, indexed by the label's symbol
+  std::vector<int> labelBlock(function->symbols.size(), -1);
+  for (const Block &b : blocks) {
+    if (b.label != NO_SYM) labelBlock[b.label] = b.index;
   }
 
-  for (Block *b : blocks) {
-    const std::vector<IRInstruction> &ins = b->ins;
-    if (ins.empty()) continue; // hmm
-
-    const IRInstruction &last = ins[ins.size() - 1];
+  for (Block &b : blocks) {
+    const IRInstruction &last = b.ins.back();
     // Anything other than a goto or return will fall through!
     if (last.op != OP::_return && last.op != OP::_goto) {
-      Block *after = b->after;
-      if (after != nullptr) {
-        b->next.push_back(after);
-        after->prev.push_back(b);
+      if (b.index + 1 < (int) blocks.size()) {
+        b.next.push_back(b.index + 1);
+        blocks[b.index + 1].prev.push_back(b.index);
       }
     }
 
-    const std::string *target = last.Target();
-    if (target == nullptr) continue;
+    Sym target = last.Target();
+    if (target == NO_SYM) continue;
 
-    // Find instruction with label target
-    Block *targetBlock = find_block(blocks, *target);
-    if (targetBlock == nullptr) {
-      throw std::runtime_error("instruction targeting nonexistent label " + *target);
+    int targetBlock = labelBlock[target];
+    if (targetBlock == -1) {
+      throw std::runtime_error("instruction targeting nonexistent label " + function->symbols.name(target));
     }
 
-    b->next.push_back(targetBlock);
-    targetBlock->prev.push_back(b);
+    b.next.push_back(targetBlock);
+    blocks[targetBlock].prev.push_back(b.index);
   }
-
-  return blocks[0];
 }
 
-std::set<std::string> Block::GetUses() const {
-  std::set<std::string> ret;
-  for (auto &it : uses) {
-    ret.insert(it.second);
-  }
-  return ret;
-}
+// Clean up the blocks as the front end laid them out, until nothing
+// changes. Each round first points jumps to a lone goto at where it goes,
+// drops the blocks the entry can't reach and the jumps to the block right
+// after, then merges each block with its only successor when it is that
+// block's only predecessor: the next block in the code loses its label, and
+// one that never falls through moves up to replace the goto to it. The
+// blocks are rebuilt after each step that changed something, so the edges
+// are always up to date.
+void simplifyCfg(Function *function) {
+  std::vector<Block> &blocks = function->blocks;
+  auto rebuild = [&](const std::vector<bool> &keep) {
+    std::vector<IRInstruction> instructions;
+    for (Block &b : blocks) {
+      if (!keep[b.index]) continue;
+      for (IRInstruction &ins : b.ins) instructions.push_back(std::move(ins));
+    }
+    createCfg(function, instructions);
+  };
+
+  for (bool changed = true; changed && !blocks.empty();) {
+    changed = false;
+    bool merging = false;
+    std::vector<int> labelBlock(function->symbols.size(), -1);
+    for (const Block &b : blocks) {
+      if (b.label != NO_SYM) labelBlock[b.label] = b.index;
+    }
+    auto onlyGoto = [&](int b) { return blocks[b].ins.size() == 1 && blocks[b].ins[0].op == OP::_goto; };
+
+    // a jump to a goto can go where it goes, unless the gotos loop
+    for (Block &b : blocks) {
+      Sym *target = b.ins.back().TargetOperand();
+      if (target == nullptr) continue;
+      std::vector<int> path { b.index };
+      Sym to = *target;
+      int t = labelBlock[to];
+      while (onlyGoto(t) && std::find(path.begin(), path.end(), t) == path.end()) {
+        path.push_back(t);
+        to = blocks[t].ins[0].Target();
+        t = labelBlock[to];
+      }
+      if (!onlyGoto(t) && to != *target) {
+        *target = to;
+        changed = true;
+      }
+    }
 
-std::set<std::string> Block::GetDefs() const {
-  std::set<std::string> ret;
-  for (auto &it : defs) {
-    ret.insert(it.second);
+    // what the entry can't reach goes away
+    std::vector<bool> keep(blocks.size(), false);
+    std::vector<int> work { 0 };
+    keep[0] = true;
+    while (!work.empty()) {
+      int b = work.back();
+      work.pop_back();
+      for (int n : blocks[b].next) {
+        if (!keep[n]) {
+          keep[n] = true;
+          work.push_back(n);
+        }
+      }
+    }
+    changed |= std::find(keep.begin(), keep.end(), false) != keep.end();
+
+    // A goto or branch to the block right after is the same as falling
+    // through. A block that is left empty goes away with its label, as long
+    // as nothing jumps to it.
+    std::vector<bool> targeted(function->symbols.size(), false);
+    for (const Block &b : blocks) {
+      if (keep[b.index] && b.ins.back().Target() != NO_SYM) targeted[b.ins.back().Target()] = true;
+    }
+    int next = -1;
+    for (int b = blocks.size() - 1; b >= 0; --b) {
+      if (!keep[b]) continue;
+      Block &block = blocks[b];
+      Sym target = block.ins.back().Target();
+      if (next != -1 && target != NO_SYM && labelBlock[target] == next) {
+        if (block.ins.size() == 1 && block.ins[0].Label() && targeted[block.ins[0].label]) {
+          next = b;
+          continue;
+        }
+        block.ins.pop_back();
+        changed = true;
+        if (block.ins.empty()) {
+          keep[b] = false;
+          continue;
+        }
+      }
+      next = b;
+    }
+    if (changed) rebuild(keep);
+
+    // merge the blocks that always run one after the other
+    keep.assign(blocks.size(), true);
+    std::vector<bool> merged(blocks.size(), false);
+    for (Block &a : blocks) {
+      if (a.next.size() != 1 || merged[a.index]) continue;
+      Block &b = blocks[a.next[0]];
+      if (b.index == 0 || b.index == a.index || b.prev.size() != 1 || merged[b.index]) continue;
+      const IRInstruction &last = a.ins.back();
+      if (!last.Terminal()) {
+        // falls through to the next block
+        b.ins[0].label = NO_SYM;
+      } else if (last.op == OP::_goto && (b.ins.back().op == OP::_goto || b.ins.back().op == OP::_return)) {
+        a.ins.pop_back();
+        b.ins[0].label = NO_SYM;
+        for (IRInstruction &ins : b.ins) a.ins.push_back(std::move(ins));
+        keep[b.index] = false;
+      } else {
+        continue;
+      }
+      merged[a.index] = merged[b.index] = true;
+      merging = true;
+    }
+    if (merging) rebuild(keep);
+    changed |= merging;
   }
-  return ret;
 }
@@ -1,48 +1,74 @@
+#pragma once
 #include "IR.h"
+#include "SmallVector.h"
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
 
 class Block;
 class Function;
 
-class Program {
+class Function {
  public:
-  std::vector<Function *> functions;
+  std::string name;
+  SymbolTable symbols;
+  std::vector<Sym> intparams;
+  std::vector<Sym> intlist, floatlist;
+  std::vector<std::pair<Sym, int>> arrays; // declared arrays and their lengths
+  std::vector<Block> blocks; // in layout order, blocks[0] is the entry
+  // The allocatable registers (see Target::mask) a call to this function
+  // may overwrite, counting its own callees. Anything, until the function
+  // has been compiled.
+  uint64_t clobbers = ~uint64_t(0);
 
-  bool IsGlobal(const std::string &var) const;
-  std::vector<std::string> GetGlobalInts() const;
+  bool isInt(Sym var) const { return var != NO_SYM && symbols.kind(var) == SymKind::local_int; }
+  bool isFloat(Sym var) const { return var != NO_SYM && symbols.kind(var) == SymKind::local_float; }
+  bool isVar(Sym var) const { return var != NO_SYM && symbols.slot(var) != -1; }
 };
 
-class Function {
+class Program {
  public:
-  std::string name;
-  std::vector<std::string> intparams;
-  std::vector<std::string> intlist, floatlist;
-  Block *start = nullptr;
-
-  bool isInt(const std::string &var) const;
-  bool isFloat(const std::string &var) const;
-  bool isVar(const std::string &var) const;
-  bool IsVariableUsed(const std::string &var) const;
+  std::vector<Function *> functions;
+  Names names;
+
+  // A variable is global when more than one function uses it. The table is
+  // built once by IndexGlobals, after every function has been read, and
+  // makes IsGlobal a single bit test.
+  std::vector<int> useCount; // per name id, how many functions use it
+  BitSet globals; // name ids used by more than one function
+
+  std::unordered_map<std::string, Function *> functionIndex; // by name, also built by IndexGlobals
+
+  void IndexGlobals();
+  bool IsGlobal(const Function *function, Sym var) const {
+    return var != NO_SYM && globals.test(function->symbols.nameId(var));
+  }
+  // nullptr if the program has no function with this name
+  Function *GetFunction(const std::string &name) const {
+    auto it = functionIndex.find(name);
+    return it == functionIndex.end() ? nullptr : it->second;
+  }
+  std::vector<std::string> GetGlobalInts() const;
+  // Every array gets a label in .data. Functions that declare arrays of
+  // the same name share them. Name and length in words, once per name.
+  std::vector<std::pair<std::string, int>> GetArrays() const;
 };
 
 class Block {
  public:
-  std::string label;
+  int index = 0; // position in Function::blocks, the block after this one in the code is index + 1
+  Sym label = NO_SYM;
   std::vector<IRInstruction> ins;
-  Block *after = nullptr; // in the code, which block is physically after this one
-  std::vector<Block *> next; // possible next blocks in the cfg
-  std::vector<Block *> prev; // previous blocks in the cfg
-  std::map<int, std::string> defs;
-  std::multimap<int, std::string> uses;
-  std::set<std::string> liveout;
+  SmallVector<int, 2> next; // possible next blocks in the cfg
+  SmallVector<int, 2> prev; // previous blocks in the cfg
 
   Block() = default;
-  Block(const std::string &_label) : label(_label) { }
-
-  std::set<std::string> GetUses() const;
-  std::set<std::string> GetDefs() const;
+  Block(int _index, Sym _label) : index(_index), label(_label) { }
 };
 
-extern Block *createCfg(const std::vector<IRInstruction> &instructions);
+// Split the instructions into the function's blocks and link up the cfg
+extern void createCfg(Function *function, const std::vector<IRInstruction> &instructions);
+// Remove the blocks nothing reaches and the jumps that aren't needed, and
+// merge blocks that always run one after the other
+extern void simplifyCfg(Function *function);
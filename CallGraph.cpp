@@ -0,0 +1,73 @@
+#include "CallGraph.h"
+#include "CodeGen.h"
+#include <algorithm>
+
+CallGraph::CallGraph(const Program *program) {
+  for (Function *function : program->functions) {
+    std::vector<Function *> &out = edges[function];
+    bool &calls = unknown[function];
+    calls = false;
+    for (const Block &block : function->blocks) {
+      for (const IRInstruction &ins : block.ins) {
+        if (ins.op != OP::call && ins.op != OP::callr) continue;
+        const std::string &name = function->symbols.name(ins.op == OP::call ? ins.arg1 : ins.arg2);
+        if (isSyscall(name)) continue;
+        Function *callee = program->GetFunction(name);
+        if (callee == nullptr) {
+          calls = true;
+        } else if (std::find(out.begin(), out.end(), callee) == out.end()) {
+          out.push_back(callee);
+        }
+      }
+    }
+  }
+
+  // Tarjan's algorithm, without recursion so deep call chains are fine. A
+  // component is finished only after everything it reaches, which is the
+  // bottom up order.
+  std::unordered_map<const Function *, int> number, low;
+  std::vector<Function *> stack; // functions of unfinished components
+  std::unordered_map<const Function *, bool> onStack;
+  std::vector<std::pair<Function *, size_t>> work; // function, next callee
+  int counter = 0;
+  for (Function *root : program->functions) {
+    if (number.count(root)) continue;
+    work.emplace_back(root, 0);
+    number[root] = low[root] = counter++;
+    stack.push_back(root);
+    onStack[root] = true;
+    while (!work.empty()) {
+      Function *f = work.back().first;
+      size_t &next = work.back().second;
+      const std::vector<Function *> &out = edges[f];
+      if (next < out.size()) {
+        Function *callee = out[next++];
+        if (!number.count(callee)) {
+          number[callee] = low[callee] = counter++;
+          stack.push_back(callee);
+          onStack[callee] = true;
+          work.emplace_back(callee, 0);
+        } else if (onStack[callee]) {
+          low[f] = std::min(low[f], number[callee]);
+        }
+        continue;
+      }
+
+      work.pop_back();
+      if (!work.empty()) {
+        Function *caller = work.back().first;
+        low[caller] = std::min(low[caller], low[f]);
+      }
+      if (low[f] == number[f]) {
+        std::vector<Function *> &scc = sccs.emplace_back();
+        Function *member;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          onStack[member] = false;
+          scc.push_back(member);
+        } while (member != f);
+      }
+    }
+  }
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "CFG.h"
+#include <unordered_map>
+#include <vector>
+
+// Who calls whom in the program. The functions are grouped into strongly
+// connected components (Tarjan) and the components are listed bottom up,
+// every one after the ones it calls, so callees can be compiled before their
+// callers and summarized for them. Syscalls aren't part of the graph.
+class CallGraph {
+ public:
+  explicit CallGraph(const Program *program);
+
+  const std::vector<std::vector<Function *>> &components() const { return sccs; }
+  // the program's functions this one calls, each once
+  const std::vector<Function *> &callees(const Function *function) const { return edges.at(function); }
+  // calls something that isn't in the program
+  bool callsUnknown(const Function *function) const { return unknown.at(function); }
+
+ private:
+  std::vector<std::vector<Function *>> sccs;
+  std::unordered_map<const Function *, std::vector<Function *>> edges;
+  std::unordered_map<const Function *, bool> unknown;
+};
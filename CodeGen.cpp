@@ -1,17 +1,69 @@
 #include "CFG.h"
 #include "Strategy.h"
+#include "Dominators.h"
+#include "FrameLayout.h"
+#include "CodeGen.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
 #include <iostream>
 #include <sstream>
 
 Program *program = nullptr;
 Strategy *strat = nullptr;
 std::stringstream *out = nullptr;
+static std::vector<std::string> saved; // callee saved registers of the current function
+static uint64_t written = 0; // allocatable registers the current function's code writes
+
+// What the code emitted since the last reset touches, going by the operands
+// so that names in comments and labels don't count
+struct Touched {
+  uint64_t registers = 0; // allocatable registers read or written, including as a base address
+  bool stack = false; // a word off $sp
+};
+static Touched touched;
 
 static void generate(Function *function, Block *block, std::stringstream &out, IRInstruction &ins);
 static void generate(Function *function, Block *block, std::stringstream &out);
 static int syscall(const std::string &name);
 static void branch(Function *function, IRInstruction &ins, const std::string &op, const std::string &comment);
 static void arith(Function *function, IRInstruction &ins, const std::string &op);
+static void call(Function *function, Block *block, IRInstruction &ins);
+static std::string value(Function *function, Sym sym, const std::string &suggestion);
+static std::string element(Function *function, Sym array, Sym index);
+
+// The IR spelling of an operand (immediate, label, function or variable name)
+static inline const std::string &text(Function *function, Sym sym) {
+  static const std::string empty;
+  return sym == NO_SYM ? empty : function->symbols.name(sym);
+}
+
+// The allocatable register called name as a mask (see Target::mask), 0 if
+// name is any other operand
+static uint64_t registerMask(const std::string &name) {
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int r = 0; r < target.count(c); ++r) {
+      if (target.name(c, r) == name) return Target::mask(c, r);
+    }
+  }
+  return 0;
+}
+
+// Note what an instruction touches, and the register it writes, which is
+// its first operand unless it is a store, a jump or a branch
+static void note(const std::string &op, const std::string &a1, const std::string &a2 = "", const std::string &a3 = "") {
+  static const std::set<std::string> reads { "sw", "s.s", "j", "jal", "jr", "beq", "bne", "blt", "bgt", "bge", "ble" };
+  if (!reads.count(op)) written |= registerMask(a1);
+  for (const std::string *a : { &a1, &a2, &a3 }) {
+    // offset(base) addresses memory through base
+    size_t open = a->find('(');
+    std::string r = open == std::string::npos ? *a : a->substr(open + 1, a->size() - open - 2);
+    touched.registers |= registerMask(r);
+    touched.stack |= r == "$sp" && open != std::string::npos;
+  }
+}
 
 void emit(const std::string &op) {
   *out << op << std::endl;
@@ -19,45 +71,205 @@ void emit(const std::string &op) {
 
 void emit(const std::string &op, const std::string &a1) {
   *out << op << ", " << a1 << std::endl;
+  note(op, a1);
 }
 
 void emit(const std::string &op, const std::string &a1, const std::string &a2) {
   *out << op << ", " << a1 << ", " << a2  << std::endl;
+  note(op, a1, a2);
 }
 
 void emit(const std::string &op, const std::string &a1, const std::string &a2, const std::string &a3) {
   *out << op << ", " << a1 << ", " << a2 << ", " << a3 << std::endl;
+  note(op, a1, a2, a3);
 }
 
 void emit(const std::string &op, const std::string &a1, const std::string &a2, const std::string &a3, const std::string &comment) {
   *out << op << ", " << a1 << ", " << a2 << ", " << a3 << " " << comment << std::endl;
+  note(op, a1, a2, a3);
 }
 
-void generate(Function *function, std::stringstream &out) {
-  strat->enterFunction();
+// The stack frame: the variables in memory (see FrameLayout), then $ra, then
+// the callee saved registers the function writes. It is shrink-wrapped: the
+// blocks are generated first, and the prologue goes at the closest block that
+// dominates every block that touches the frame, so paths that never need it
+// (the base case of a recursive function) don't pay for it. Returns inside
+// the frame share one epilogue.
+struct Frame {
+  int size = 0; // words
+  int ra = 0; // offset of $ra
+  bool calls = false; // makes a jal, so $ra needs saving
+  std::string epilogue; // label of the shared epilogue, if there is more than one return
+};
+
+// does the block call a function? The jal overwrites $ra, so it needs saving
+static bool callsFunction(const Function *function, const Block &block) {
+  for (const IRInstruction &ins : block.ins) {
+    if ((ins.op == OP::call || ins.op == OP::callr) && !isSyscall(function->symbols.name(ins.op == OP::call ? ins.arg1 : ins.arg2))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Does code use the stack frame? It does if it loads or stores a variable
+// the strategy keeps in memory (or a stack argument), or touches one of the
+// callee saved registers the strategy says the function writes.
+static bool needsFrame(const Touched &code, uint64_t saved) {
+  return code.stack || (code.registers & saved);
+}
+
+// The prologue can't go in a loop, and everything after it must be inside
+// the frame, so no path can reach the code after it without going through it.
+static bool canWrap(Function *function, const Dominators &dom, int start) {
+  if (dom.inLoop(start)) return false;
+  std::vector<bool> seen(function->blocks.size(), false);
+  std::vector<int> work { start };
+  seen[start] = true;
+  while (!work.empty()) {
+    int b = work.back();
+    work.pop_back();
+    if (!dom.dominates(start, b)) return false;
+    for (int n : function->blocks[b].next) {
+      if (!seen[n]) {
+        seen[n] = true;
+        work.push_back(n);
+      }
+    }
+  }
+  return true;
+}
 
-  int numVariables = strat->numVariables() + 1; // for $ra
-  emit("addiu", "$sp", "$sp", std::to_string(-4 * numVariables)); // allocate space on the stack for variables
-  emit("sw", "$ra", std::to_string((numVariables - 1) * 4) + "($sp)"); // store $ra on stack
+static bool isFloatRegister(const std::string &r) {
+  return r.compare(0, 2, "$f") == 0;
+}
 
-  // Copy function parameters to stack as they will get clobbered if this function calls another function
-  // Note that the function parameters are also in int-list and so stack space has been assigned already
-  int paramCnt = 0;
-  for (const std::string &param : function->intparams) {
-    strat->store("$a" + std::to_string(paramCnt++), param);
+static void prologue(const Frame &frame) {
+  emit("addiu", "$sp", "$sp", std::to_string(-4 * frame.size)); // allocate space on the stack for variables
+  if (frame.calls) emit("sw", "$ra", std::to_string(frame.ra) + "($sp)"); // store $ra on stack
+  for (size_t i = 0; i < saved.size(); ++i) {
+    emit(isFloatRegister(saved[i]) ? "s.s" : "sw", saved[i], std::to_string(frame.ra + 4 * (i + 1)) + "($sp)");
   }
+}
 
-  generate(function, function->start, out);
+static void epilogue(const Frame &frame) {
+  for (size_t i = 0; i < saved.size(); ++i) {
+    emit(isFloatRegister(saved[i]) ? "l.s" : "lw", saved[i], std::to_string(frame.ra + 4 * (i + 1)) + "($sp)");
+  }
+  if (frame.calls) emit("lw", "$ra", std::to_string(frame.ra) + "($sp)"); // load $ra from stack
+  emit("addiu", "$sp", "$sp", std::to_string(4 * frame.size)); // remove space from stack
+  emit("jr", "$ra"); // jump to return address
 }
 
-void generate(Function *function, Block *block, std::stringstream &out) {
-  if (block->ins.empty() == false && block->ins[0].Label()) {
-    IRInstruction &ins = block->ins[0];
-    // functions have labels with the same name as their function name
-    if (ins.label != function->name) {
-      out << ins.label << ":" << std::endl;
+void generate(Function *function, std::stringstream &out) {
+  written = 0;
+  strat->enterFunction();
+  saved = strat->savedRegisters();
+  std::vector<Block> &blocks = function->blocks;
+
+  // stack slots for what the strategy keeps in memory
+  BitSet memory;
+  for (int slot = 0; slot < function->symbols.numVariables(); ++slot) {
+    Sym variable = function->symbols.variable(slot);
+    if (!program->IsGlobal(function, variable) && strat->inMemory(variable)) memory.insert(slot);
+  }
+  layout.compute(function, memory);
+
+  Frame frame;
+  frame.size = layout.words() + 1 + saved.size();
+  frame.ra = layout.words() * 4;
+
+  // Copy the parameters to wherever the strategy keeps them (nothing to do
+  // for the ones it leaves in their $a register). The ones past the fourth
+  // are on the stack just above our frame.
+  std::stringstream params;
+  ::out = &params;
+  touched = Touched();
+  for (size_t i = 0; i < function->intparams.size(); ++i) {
+    Sym param = function->intparams[i];
+    if (i < 4) {
+      strat->store("$a" + std::to_string(i), param);
+      continue;
     }
+    std::string r = strat->destination(param, "$t0");
+    emit("lw", r, std::to_string(4 * (frame.size + i - 4)) + "($sp)", "# parameter " + std::to_string(i));
+    strat->store(r, param);
+  }
+
+  Touched entry = touched;
+
+  std::vector<std::string> code(blocks.size());
+  std::vector<Touched> uses(blocks.size());
+  std::stringstream s;
+  ::out = &s;
+  for (Block &block : blocks) {
+    s.str("");
+    touched = Touched();
+    generate(function, &block, s);
+    code[block.index] = s.str();
+    uses[block.index] = touched;
   }
+  ::out = &out;
+
+  uint64_t savedMask = 0;
+  for (const std::string &r : saved) savedMask |= registerMask(r);
+
+  Dominators dom;
+  dom.compute(function);
+  int start = -1; // block that sets up the frame, -1 if nothing needs one
+  for (Block &block : blocks) {
+    bool need = callsFunction(function, block) || needsFrame(uses[block.index], savedMask) ||
+        (block.index == 0 && needsFrame(entry, savedMask));
+    if (!need || !dom.reachable(block.index)) continue;
+    if (start == -1) {
+      start = block.index;
+    } else if (!dom.dominates(start, block.index)) {
+      start = dom.common(start, block.index);
+    }
+    frame.calls |= callsFunction(function, block);
+  }
+  if (start > 0 && !canWrap(function, dom, start)) start = 0;
+
+  auto returns = [&](const Block &block) {
+    return !block.ins.empty() && block.ins.back().op == OP::_return;
+  };
+  auto inFrame = [&](const Block &block) {
+    return start != -1 && dom.dominates(start, block.index);
+  };
+  int framed = 0;
+  for (Block &block : blocks) {
+    if (returns(block) && inFrame(block)) ++framed;
+  }
+  if (framed > 1) frame.epilogue = function->name + "_epilogue";
+
+  if (start == 0) prologue(frame);
+  out << params.str();
+  for (Block &block : blocks) {
+    if (!block.ins.empty() && block.ins[0].Label()) {
+      // functions have labels with the same name as their function name
+      if (text(function, block.ins[0].label) != function->name) {
+        out << text(function, block.ins[0].label) << ":" << std::endl;
+      }
+    }
+    if (block.index == start && start != 0) prologue(frame);
+    out << code[block.index];
+
+    if (!returns(block)) continue;
+    if (!inFrame(block)) {
+      emit("jr", "$ra"); // nothing to undo on this path
+    } else if (frame.epilogue.empty()) {
+      epilogue(frame);
+    } else if (block.index + 1 != (int) blocks.size()) {
+      emit("j", frame.epilogue);
+    }
+  }
+  if (!frame.epilogue.empty()) {
+    out << frame.epilogue << ":" << std::endl;
+    epilogue(frame);
+  }
+}
+
+void generate(Function *function, Block *block, std::stringstream &out) {
   strat->enterBlock(block);
   for (IRInstruction &ins : block->ins) {
     generate(function, block, out, ins);
@@ -65,13 +277,10 @@ void generate(Function *function, Block *block, std::stringstream &out) {
   if (!block->ins.empty() && !block->ins[block->ins.size() - 1].Terminal()) {
     strat->exitBlock(block);
   }
-  Block *next = block->after;
-  if (next != nullptr) {
-    generate(function, next, out);
-  }
 }
 
 void generate(Function *function, Block *block, std::stringstream &out, IRInstruction &ins) {
+  strat->enterInstruction(block, &ins);
   if (ins.Terminal()) {
     // this is the last instruction in the block! exit block to save stack before jumping
     strat->exitBlock(block);
@@ -81,17 +290,17 @@ void generate(Function *function, Block *block, std::stringstream &out, IRInstru
     {
       // arg1 = arg2
 
-      if(ins.arg3 == "") {
+      if(ins.arg3 == NO_SYM) {
         std::string a2;
-        if (program->IsGlobal(ins.arg2)) {
-          a2 = strat->reg(ins.arg2, "$t0");
+        if (program->IsGlobal(function, ins.arg2)) {
+          a2 = strat->reg(ins.arg2, strat->destination(ins.arg1, "$t0"));
         } else if (function->isInt(ins.arg2)) {
-          // get register for arg2
-          a2 = strat->reg(ins.arg2, "$t0");
+          // get register for arg2, loading straight into arg1's if it has one
+          a2 = strat->reg(ins.arg2, strat->destination(ins.arg1, "$t0"));
         } else if (function->isFloat(ins.arg2)) {
-          a2 = strat->reg(ins.arg2, "$f0");
+          a2 = strat->reg(ins.arg2, function->isFloat(ins.arg1) ? strat->destination(ins.arg1, "$f0") : "$f0");
         } else {
-          a2 = ins.arg2;
+          a2 = text(function, ins.arg2);
         }
 
         // store into arg1
@@ -101,22 +310,14 @@ void generate(Function *function, Block *block, std::stringstream &out, IRInstru
       //assign, X, 100, 10
       else {
         // Assign array
-        // int size = atoi(ins.arg2.c_str());
-        const std::string &arr = ins.arg1;
-        const std::string &length = ins.arg2;
-        const std::string &val = ins.arg3;
-
-        if(true) { // This will be immediate
-          emit("la", "$t0", arr);
-          emit("li", "$t1", val);
-          int size = atoi(length.c_str());
-          for(int i = 0; i < size; i++){
-            emit("sw", "$t1", std::to_string(4*i) + "($t0)");
-          }
-        } else if (false){ // this will be from var
-          // TODO implement
-        } else { // this will be float
-          // TODO implement
+        const std::string &arr = text(function, ins.arg1);
+        const std::string &length = text(function, ins.arg2);
+        std::string val = value(function, ins.arg3, "$t1");
+
+        emit("la", "$t0", arr);
+        int size = atoi(length.c_str());
+        for(int i = 0; i < size; i++){
+          emit(isFloatRegister(val) ? "s.s" : "sw", val, std::to_string(4*i) + "($t0)");
         }
 
       }
@@ -142,125 +343,116 @@ void generate(Function *function, Block *block, std::stringstream &out, IRInstru
       arith(function, ins, "or");
       break;
     case OP::_goto:
-      emit("j", *ins.Target());
+      emit("j", text(function, ins.Target()));
       break;
     case OP::breq:
-      branch(function, ins, "beq", "# if (" + ins.arg1 + " == " + ins.arg2 + ") goto " + ins.arg3);
+      branch(function, ins, "beq", "# if (" + text(function, ins.arg1) + " == " + text(function, ins.arg2) + ") goto " + text(function, ins.arg3));
       break;
     case OP::brneq:
-      branch(function, ins, "bne", "# if (" + ins.arg1 + " != " + ins.arg2 + ") goto " + ins.arg3);
+      branch(function, ins, "bne", "# if (" + text(function, ins.arg1) + " != " + text(function, ins.arg2) + ") goto " + text(function, ins.arg3));
       break;
     case OP::brlt:
-      branch(function, ins, "blt", "# if (" + ins.arg1 + " < " + ins.arg2 + ") goto " + ins.arg3);
+      branch(function, ins, "blt", "# if (" + text(function, ins.arg1) + " < " + text(function, ins.arg2) + ") goto " + text(function, ins.arg3));
       break;
     case OP::brgt:
-      branch(function, ins, "bgt", "# if (" + ins.arg1 + " > " + ins.arg2 + ") goto " + ins.arg3);
+      branch(function, ins, "bgt", "# if (" + text(function, ins.arg1) + " > " + text(function, ins.arg2) + ") goto " + text(function, ins.arg3));
       break;
     case OP::brgeq:
-      branch(function, ins, "bge", "# if (" + ins.arg1 + " >= " + ins.arg2 + ") goto " + ins.arg3);
+      branch(function, ins, "bge", "# if (" + text(function, ins.arg1) + " >= " + text(function, ins.arg2) + ") goto " + text(function, ins.arg3));
       break;
     case OP::brleq:
-      branch(function, ins, "ble", "# if (" + ins.arg1 + " <= " + ins.arg2 + ") goto " + ins.arg3);
+      branch(function, ins, "ble", "# if (" + text(function, ins.arg1) + " <= " + text(function, ins.arg2) + ") goto " + text(function, ins.arg3));
       break;
     case OP::_return:
     {
-      int numVariables = strat->numVariables() + 1; // for $ra
-      // store result into $v0
-      if (!ins.arg1.empty()) {
+      // store result into $v0, generate() adds the jump back to the caller
+      if (ins.arg1 != NO_SYM) {
         if (function->isInt(ins.arg1)) {
           strat->reg(ins.arg1, "$v0"); // load variable into $v0
         } else {
-          emit("li", "$v0", ins.arg1);
+          emit("li", "$v0", text(function, ins.arg1));
         }
       }
-
-      emit("lw", "$ra", std::to_string((numVariables - 1) * 4) + "($sp)"); // load $ra from stack
-      emit("addiu", "$sp", "$sp", std::to_string(4 * numVariables)); // remove space from stack
-      emit("jr", "$ra"); // jump to return address
       break;
     }
-    case OP::call:
-    {
-      // arg1 = function, arg2/arg3 arguments
-      const std::string &func = ins.arg1;
-      // load arguments into a0-a3. we only support two arguments though.
-      const std::string &arg1 = ins.arg2;
-      const std::string &arg2 = ins.arg3;
-      bool isfloat = func == "printf"; // XXX
-
-      if (!arg1.empty()) strat->reg(arg1, isfloat ? "$f12" : "$a0");
-      if (!arg2.empty()) strat->reg(arg2, isfloat ? "$f12" : "$a1");
-
-      int syscallId = syscall(func);
-      if (syscallId != -1) {
-        emit("li", "$v0", std::to_string(syscallId));
-        emit("syscall", "# " + func);
-      } else {
-        strat->spill(block, &ins);
-        emit("jal", func);
-        strat->unspill(block, &ins);
-      }
+    case OP::call: // call, fn, args...
+    case OP::callr: // callr, x, fn, args...
+      call(function, block, ins);
+      break;
+    case OP::array_store: {
+      // array_store, X, index, x
+      std::string x = value(function, ins.arg3, "$t2");
+      emit(isFloatRegister(x) ? "s.s" : "sw", x, element(function, ins.arg1, ins.arg2));
       break;
     }
-    case OP::callr:
-    {
-      // arg1 = return variable, arg2 = function, arg3 = argument
-      const std::string &ret = ins.arg1;
-      const std::string &func = ins.arg2;
-      const std::string &arg1 = ins.arg3;
-      bool isfloat = func == "printf"; // XXX
-
-      if (!arg1.empty()) strat->reg(arg1, isfloat ? "$f12" : "$a0");
-
-      int syscallId = syscall(func);
-      if (syscallId != -1) {
-        emit("li", "$v0", std::to_string(syscallId));
-        emit("syscall", "# " + func);
+    case OP::array_load: {
+      // array_load, x, X, index
+      std::string at = element(function, ins.arg2, ins.arg3);
+      std::string x = strat->destination(ins.arg1, function->isFloat(ins.arg1) ? "$f0" : "$t1");
+      emit(isFloatRegister(x) ? "l.s" : "lw", x, at);
+      strat->store(x, ins.arg1);
+      break;
+    }
+    case OP::address: {
+      // address, p, X, index. Addresses the compiler works out use addu:
+      // the trapping add could fault where the program never would.
+      if (function->isVar(ins.arg3) || program->IsGlobal(function, ins.arg3)) {
+        emit("sll", "$t1", strat->reg(ins.arg3, "$t1"), "2");
+        emit("la", "$t0", text(function, ins.arg2));
+        strat->emitAndStore("addu", ins.arg1, "$t0", "$t1");
       } else {
-        strat->spill(block, &ins);
-        emit("jal", func);
-        strat->unspill(block, &ins);
+        std::string p = strat->destination(ins.arg1, "$t0");
+        emit("la", p, element(function, ins.arg2, ins.arg3));
+        strat->store(p, ins.arg1);
       }
-
-      // result is in $v0
-      strat->store("$v0", ret);
       break;
     }
-    case OP::array_store: {
-      const std::string &arr = ins.arg1;
-      const std::string &offset = ins.arg2;
-      const std::string &x = ins.arg3;
-      emit("# start array store ");
-      emit("la", "$t0", x);
-      emit("lw", "$t1", "0($t0)");
-      emit("la", "$t0", offset);
-      emit("lw", "$t2", "0($t0)");
-      emit("sll", "$t2", "$t2", "2");
-      emit("la", "$t0", arr);
-      emit("add" "$t0", "$t0", "$t2");
-      emit("srl", "$t2", "$t2", "2");
-      emit("sw", "$t1", "0($t0)");
-      emit("# end array store ");
+    case OP::load: {
+      // load, x, p
+      std::string p = strat->reg(ins.arg2, "$t0");
+      std::string x = strat->destination(ins.arg1, function->isFloat(ins.arg1) ? "$f0" : "$t1");
+      emit(isFloatRegister(x) ? "l.s" : "lw", x, "0(" + p + ")");
+      strat->store(x, ins.arg1);
       break;
     }
-    case OP::array_load: {
-        const std::string &x = ins.arg1;
-        const std::string &arr = ins.arg2;
-        const std::string &offset = ins.arg3;
-        emit("# start array load ");
-        emit("la", "$t0", offset);
-        emit("lw", "$t1", "0($t0)");
-        emit("sll", "$t1", "$t1", "2");
-        emit("la", "$t0", arr);
-        emit("add", "$t0", "$t0", "$t1");
-        emit("srl", "$t1", "$t1", "2");
-        emit("lw", "$t1", "0($t0)");
-        emit("la","$t0",x);
-        emit("sw", "$t1", "0($t0)");
-        emit("# end array load ");
-        break;
+    case OP::store: {
+      // store, p, x
+      std::string x = value(function, ins.arg2, "$t2");
+      std::string p = strat->reg(ins.arg1, "$t0");
+      emit(isFloatRegister(x) ? "s.s" : "sw", x, "0(" + p + ")");
+      break;
     }
+    case OP::advance:
+      // advance, q, p, n (addu, like address)
+      strat->emitAndStore("addu", ins.arg1, strat->reg(ins.arg2, "$t0"), text(function, ins.arg3));
+      break;
+  }
+}
+
+// An int or float operand in a register, suggestion (or $f0 for a float
+// constant) if it isn't in one already
+static std::string value(Function *function, Sym sym, const std::string &suggestion) {
+  if (function->isFloat(sym)) return strat->reg(sym, "$f0");
+  if (function->isVar(sym) || program->IsGlobal(function, sym)) return strat->reg(sym, suggestion);
+  std::string r = function->symbols.kind(sym) == SymKind::imm_float ? "$f0" : suggestion;
+  loadImmediate(r, text(function, sym));
+  return r;
+}
+
+// The address of X[index] as a lw or sw operand. A constant index goes in
+// the label's offset, otherwise the address is worked out in $t0.
+static std::string element(Function *function, Sym array, Sym index) {
+  const std::string &arr = text(function, array);
+  if (!function->isVar(index) && !program->IsGlobal(function, index)) {
+    int offset = 4 * atoi(text(function, index).c_str());
+    if (offset == 0) return arr;
+    return arr + (offset > 0 ? "+" : "") + std::to_string(offset);
   }
+  std::string i = strat->reg(index, "$t1");
+  emit("sll", "$t1", i, "2");
+  emit("la", "$t0", arr);
+  emit("add", "$t0", "$t0", "$t1");
+  return "0($t0)";
 }
 
 static void branch(Function *function, IRInstruction &ins, const std::string &op, const std::string &comment) {
@@ -270,7 +462,7 @@ static void branch(Function *function, IRInstruction &ins, const std::string &op
     a1 = strat->reg(ins.arg1, "$t0");
   } else {
     // arg1 must be a register, so we li the constant into it
-    emit("li", "$t0", ins.arg1);
+    emit("li", "$t0", text(function, ins.arg1));
     a1 = "$t0";
   }
 
@@ -278,10 +470,10 @@ static void branch(Function *function, IRInstruction &ins, const std::string &op
   if (function->isInt(ins.arg2)) {
     a2 = strat->reg(ins.arg2, "$t1");
   } else {
-    a2 = ins.arg2;
+    a2 = text(function, ins.arg2);
   }
 
-  std::string label = ins.arg3;
+  std::string label = text(function, ins.arg3);
   emit(op, a1, a2, label, comment);
 }
 
@@ -295,12 +487,12 @@ static void arith(Function *function, IRInstruction &ins, const std::string &op)
     isfloat = true;
   } else {
     // arg1 must be a register, so we li the constant into it
-    if (ins.arg1.find('.') != std::string::npos) {
-      emit("li.s", "$f0", ins.arg1);
+    if (function->symbols.kind(ins.arg1) == SymKind::imm_float) {
+      loadImmediate("$f0", text(function, ins.arg1));
       a1 = "$f0";
       isfloat = true;
     } else {
-      emit("li", "$t0", ins.arg1);
+      emit("li", "$t0", text(function, ins.arg1));
       a1 = "$t0";
     }
   }
@@ -312,13 +504,13 @@ static void arith(Function *function, IRInstruction &ins, const std::string &op)
     a2 = strat->reg(ins.arg2, "$f2");
     isfloat = true;
   } else {
-    if (ins.arg2.find('.') != std::string::npos) {
+    if (function->symbols.kind(ins.arg2) == SymKind::imm_float) {
       // there is no pseudo instruction for add for floats that takes an immediate
-      emit("li.s", "$f2", ins.arg2);
+      loadImmediate("$f2", text(function, ins.arg2));
       a2 = "$f2";
       isfloat = true;
     } else {
-      a2 = ins.arg2;
+      a2 = text(function, ins.arg2);
     }
   }
 
@@ -331,8 +523,255 @@ static void arith(Function *function, IRInstruction &ins, const std::string &op)
 }
 
 
+// Get a call argument into register r, and return the register it ended up
+// in (strategies may leave it in the variable's own register)
+static std::string argument(Function *function, Sym arg, const std::string &r) {
+  if (function->isVar(arg) || program->IsGlobal(function, arg)) return strat->reg(arg, r);
+  loadImmediate(r, text(function, arg));
+  return r;
+}
+
+// The first four arguments go in $a0 - $a3 and the rest on the stack, right
+// above the callee's frame: they are stored below $sp, and $sp moves down
+// over them for the jal. Values that live across the call are saved before
+// any argument register is written.
+static void call(Function *function, Block *block, IRInstruction &ins) {
+  const std::string &func = text(function, ins.op == OP::call ? ins.arg1 : ins.arg2);
+  bool isfloat = floatCall(function, ins);
+  int syscallId = syscall(func);
+  int args = ins.NumArgs();
+  int stacked = std::max(0, args - 4);
+
+  if (syscallId == -1) strat->spill(block, &ins);
+  for (int i = 0; i < args && i < 4; ++i) {
+    argument(function, ins.Arg(i), isfloat ? "$f12" : "$a" + std::to_string(i));
+  }
+  for (int i = 4; i < args; ++i) {
+    std::string r = argument(function, ins.Arg(i), "$t0");
+    emit("sw", r, std::to_string(-4 * (stacked - (i - 4))) + "($sp)", "# argument " + std::to_string(i));
+  }
+
+  if (syscallId != -1) {
+    emit("li", "$v0", std::to_string(syscallId));
+    emit("syscall", "# " + func);
+  } else {
+    if (stacked) emit("addiu", "$sp", "$sp", std::to_string(-4 * stacked));
+    emit("jal", func);
+    if (stacked) emit("addiu", "$sp", "$sp", std::to_string(4 * stacked));
+    strat->unspill(block, &ins);
+  }
+
+  // result is in $v0
+  if (ins.op == OP::callr) strat->store("$v0", ins.arg1);
+}
+
 static int syscall(const std::string &name) {
   if (name == "printi") return 1;
   if (name == "printf") return 2;
   return -1;
 }
+
+bool floatCall(const Function *function, const IRInstruction &call) {
+  return function->symbols.name(call.op == OP::call ? call.arg1 : call.arg2) == "printf";
+}
+
+bool isSyscall(const std::string &name) {
+  return syscall(name) != -1;
+}
+
+// callee saved registers are put back before returning, so no call
+// clobbers them
+static uint64_t callerSaved() {
+  uint64_t regs = 0;
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int r = 0; r < target.count(c); ++r) {
+      if (!target.calleeSaved(c, r)) regs |= Target::mask(c, r);
+    }
+  }
+  return regs;
+}
+
+uint64_t clobbers(const Function *function, const IRInstruction &call) {
+  const std::string &name = function->symbols.name(call.op == OP::call ? call.arg1 : call.arg2);
+  if (isSyscall(name)) return 0;
+  Function *callee = program->GetFunction(name);
+  return (callee ? callee->clobbers : ~uint64_t(0)) & callerSaved();
+}
+
+uint64_t clobbered() {
+  return written & callerSaved();
+}
+
+static std::vector<std::pair<std::string, std::string>> pool; // label, literal
+static std::map<uint32_t, int> pooled; // bits of the value -> index in pool
+
+std::string floatConstant(const std::string &literal) {
+  // the same value can be spelled differently, 2.0 and 2.00
+  float value = std::strtof(literal.c_str(), nullptr);
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof bits);
+  auto it = pooled.find(bits);
+  if (it == pooled.end()) {
+    it = pooled.emplace(bits, pool.size()).first;
+    pool.emplace_back("_float" + std::to_string(pool.size()), literal);
+  }
+  return pool[it->second].first;
+}
+
+const std::vector<std::pair<std::string, std::string>> &floatConstants() {
+  return pool;
+}
+
+void loadImmediate(const std::string &r, const std::string &value, const std::string &comment) {
+  std::string op = isFloatRegister(r) ? "l.s" : "li";
+  std::string v = isFloatRegister(r) ? floatConstant(value) : value;
+  if (comment.empty()) emit(op, r, v);
+  else emit(op, r, v, comment);
+}
+
+void move(const std::string &to, const std::string &from, const std::string &comment) {
+  std::string op = isFloatRegister(to) ? "mov.s" : "move";
+  if (comment.empty()) emit(op, to, from);
+  else emit(op, to, from, comment);
+}
+
+std::vector<bool> registerParams(const Function *function, const Liveness &liveness) {
+  const std::vector<Sym> &params = function->intparams;
+  std::vector<bool> keep(params.size(), false);
+  for (size_t i = 0; i < params.size() && i < 4; ++i) keep[i] = true;
+
+  // A jal clobbers every $a register, a syscall only the ones its arguments
+  // go in. Arguments are set in order, so a later argument can't read a
+  // parameter whose register an earlier one already overwrote.
+  const SymbolTable &symbols = function->symbols;
+  for (const Block &block : function->blocks) {
+    liveness.walk(block, [&](int idx, const BitSet &liveout) {
+      const IRInstruction &ins = block.ins[idx];
+      if (ins.op != OP::call && ins.op != OP::callr) return;
+      bool jal = syscall(symbols.name(ins.op == OP::call ? ins.arg1 : ins.arg2)) == -1;
+      int args = ins.NumArgs();
+      for (size_t i = 0; i < params.size() && i < 4; ++i) {
+        if (liveout.test(symbols.slot(params[i])) && (jal || int(i) < args)) keep[i] = false;
+        for (int later = i + 1; later < args; ++later) {
+          if (ins.Arg(later) == params[i]) keep[i] = false;
+        }
+      }
+    });
+  }
+  return keep;
+}
+
+std::map<Sym, Sym> foldConstants(Function *function, const Liveness &liveness) {
+  const SymbolTable &symbols = function->symbols;
+  auto immediate = [&](Sym s) { return s != NO_SYM && symbols.kind(s) == SymKind::imm_int; };
+
+  // parameters and anything read before it is set have a value from outside
+  std::vector<bool> other(symbols.size(), false);
+  for (Sym param : function->intparams) other[param] = true;
+  liveness.liveIn(0).for_each([&](int slot) { other[symbols.variable(slot)] = true; });
+
+  // a fold can make the variable it copies into constant too, so repeat
+  std::vector<Sym> value(symbols.size());
+  std::vector<int> defs(symbols.size());
+  auto constant = [&](Sym s) {
+    return function->isInt(s) && !other[s] && !program->IsGlobal(function, s) && defs[s] == 1 && value[s] != NO_SYM;
+  };
+  for (bool changed = true; changed;) {
+    changed = false;
+    std::fill(value.begin(), value.end(), NO_SYM);
+    std::fill(defs.begin(), defs.end(), 0);
+    for (const Block &block : function->blocks) {
+      for (const IRInstruction &ins : block.ins) {
+        Sym def = ins.Def();
+        if (!function->isInt(def)) continue;
+        defs[def]++;
+        if (ins.op == OP::assign && ins.arg3 == NO_SYM && immediate(ins.arg2)) value[def] = ins.arg2;
+      }
+    }
+    auto fold = [&](Sym &s) {
+      if (!constant(s)) return;
+      s = value[s];
+      changed = true;
+    };
+
+    for (Block &block : function->blocks) {
+      for (IRInstruction &ins : block.ins) {
+        switch (ins.op) {
+          case OP::assign:
+            if (ins.arg3 == NO_SYM) fold(ins.arg2);
+            break;
+          case OP::add:
+          case OP::mult:
+          case OP::_and:
+          case OP::_or:
+            // only the second operand can be an immediate
+            if (constant(ins.arg1) && function->isInt(ins.arg2) && !constant(ins.arg2)) std::swap(ins.arg1, ins.arg2);
+            // fall through
+          case OP::sub:
+          case OP::div:
+            if (!function->isFloat(ins.arg1) && symbols.kind(ins.arg1) != SymKind::imm_float) fold(ins.arg2);
+            break;
+          case OP::breq:
+          case OP::brneq:
+          case OP::brlt:
+          case OP::brgt:
+          case OP::brgeq:
+          case OP::brleq:
+            if (constant(ins.arg1) && function->isInt(ins.arg2) && !constant(ins.arg2)) {
+              // a < b is b > a
+              std::swap(ins.arg1, ins.arg2);
+              if (ins.op == OP::brlt) ins.op = OP::brgt;
+              else if (ins.op == OP::brgt) ins.op = OP::brlt;
+              else if (ins.op == OP::brgeq) ins.op = OP::brleq;
+              else if (ins.op == OP::brleq) ins.op = OP::brgeq;
+            }
+            fold(ins.arg2);
+            break;
+          case OP::array_load:
+          case OP::array_store:
+          case OP::address:
+          case OP::call:
+          case OP::callr:
+          case OP::_return:
+            // arguments, return values and stored values of constants are
+            // loaded with li, and a constant index goes in the address
+            for (Sym *used : ins.UseOperands()) fold(*used);
+            break;
+          default:
+            break;
+        }
+      }
+    }
+  }
+
+  // delete the constants' defs nothing reads anymore
+  std::vector<bool> read(symbols.size(), false);
+  for (const Block &block : function->blocks) {
+    for (const IRInstruction &ins : block.ins) {
+      for (Sym used : ins.Uses()) {
+        if (function->isVar(used)) read[used] = true;
+      }
+    }
+  }
+  std::map<Sym, Sym> constants;
+  for (Block &block : function->blocks) {
+    std::vector<IRInstruction> code;
+    code.reserve(block.ins.size());
+    Sym label = NO_SYM; // of a def that went away
+    for (IRInstruction &ins : block.ins) {
+      Sym def = ins.Def();
+      if (constant(def) && read[def]) constants[def] = value[def];
+      if (constant(def) && !read[def] && &ins != &block.ins.back()) {
+        if (ins.label != NO_SYM) label = ins.label;
+        continue;
+      }
+      if (label != NO_SYM) {
+        ins.label = label;
+        label = NO_SYM;
+      }
+      code.push_back(ins);
+    }
+    block.ins = std::move(code);
+  }
+  return constants;
+}
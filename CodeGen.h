@@ -1,12 +1,44 @@
 
 class Strategy;
 class Program;
+class Liveness;
 
 extern Program *program;
 extern Strategy *strat;
 extern std::stringstream *out;
 
 extern void generate(Function *program, std::stringstream &out);
+
+extern bool isSyscall(const std::string &name);
+// Whether a call passes its arguments in $f12 instead of $a0 - $a3. Only
+// the printf syscall does.
+extern bool floatCall(const Function *function, const IRInstruction &call);
+// The allocatable registers (see Target::mask) a call may overwrite; none
+// for syscalls, every caller saved one for functions not compiled yet
+extern uint64_t clobbers(const Function *function, const IRInstruction &call);
+// The caller saved allocatable registers the code of the function generate()
+// did last writes
+extern uint64_t clobbered();
+
+// There is no float immediate, so float literals go in a constant pool in
+// .data, one word per distinct value. Returns the label of literal's word.
+extern std::string floatConstant(const std::string &literal);
+// label and literal of each word in the pool
+extern const std::vector<std::pair<std::string, std::string>> &floatConstants();
+// Put an int or float immediate in register r
+extern void loadImmediate(const std::string &r, const std::string &value, const std::string &comment = "");
+// Copy between two registers of the same class
+extern void move(const std::string &to, const std::string &from, const std::string &comment = "");
+
+// For each parameter, whether it can stay in the $a register it arrives in
+// instead of being copied out: nothing overwrites that register while the
+// parameter is still needed
+extern std::vector<bool> registerParams(const Function *function, const Liveness &liveness);
+// Reads of a variable that only ever holds one int constant become the
+// constant wherever the instruction takes an immediate, and defs nothing
+// reads anymore are deleted. Returns the constant variables still read, and
+// their values: rather than spilling those, load the constant again.
+extern std::map<Sym, Sym> foldConstants(Function *function, const Liveness &liveness);
 extern void emit(const std::string &op);
 extern void emit(const std::string &op, const std::string &a1);
 extern void emit(const std::string &op, const std::string &a1, const std::string &a2);
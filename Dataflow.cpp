@@ -0,0 +1,66 @@
+#include "Dataflow.h"
+
+std::vector<int> reversePostorder(const Function *function) {
+  const std::vector<Block> &blocks = function->blocks;
+  std::vector<int> order;
+  order.reserve(blocks.size());
+  if (blocks.empty()) return order;
+
+  // iterative dfs, the stack holds (block, next successor to visit)
+  std::vector<bool> visited(blocks.size(), false);
+  std::vector<std::pair<int, unsigned int>> stack;
+  stack.emplace_back(0, 0);
+  visited[0] = true;
+  while (!stack.empty()) {
+    auto &top = stack.back();
+    const Block &block = blocks[top.first];
+    if (top.second < block.next.size()) {
+      int succ = block.next[top.second++];
+      if (!visited[succ]) {
+        visited[succ] = true;
+        stack.emplace_back(succ, 0);
+      }
+    } else {
+      order.push_back(top.first);
+      stack.pop_back();
+    }
+  }
+  std::reverse(order.begin(), order.end());
+
+  for (const Block &block : blocks) {
+    if (!visited[block.index]) order.push_back(block.index);
+  }
+  return order;
+}
+
+void Liveness::step(const IRInstruction &ins, BitSet &live) const {
+  Sym def = ins.Def();
+  if (function->isVar(def)) {
+    live.erase(function->symbols.slot(def));
+  }
+  for (Sym used : ins.Uses()) {
+    if (function->isVar(used)) live.insert(function->symbols.slot(used));
+  }
+}
+
+void Liveness::compute(const Function *function) {
+  this->function = function;
+  size_t universe = function->symbols.numVariables();
+
+  // GEN is what a block reads before writing it, KILL is what it writes
+  sets.gen.assign(function->blocks.size(), BitSet());
+  sets.kill.assign(function->blocks.size(), BitSet());
+  for (const Block &block : function->blocks) {
+    BitSet &gen = sets.gen[block.index];
+    BitSet &kill = sets.kill[block.index];
+    for (int i = block.ins.size() - 1; i >= 0; --i) {
+      Sym def = block.ins[i].Def();
+      if (function->isVar(def)) {
+        kill.insert(function->symbols.slot(def));
+      }
+      step(block.ins[i], gen);
+    }
+  }
+
+  flow.solve(function, universe, sets, BitSet());
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include "CFG.h"
+#include "BitSet.h"
+#include <algorithm>
+#include <vector>
+
+// Iterative bit-vector dataflow over a function's blocks. The problem is
+// described at compile time by three policies:
+//
+//  Direction - Forward or Backward, which cfg edges feed a block
+//  Meet      - Union or Intersect, how the sets from those edges combine
+//  Transfer  - bool operator()(int block, const BitSet &in, BitSet &out),
+//              computes the far side of the block and returns true if it
+//              changed
+//
+// "in" is the set where flow enters the block (the block start for forward
+// problems, the block end for backward ones) and "out" is where it leaves.
+// Blocks are visited from a worklist seeded in reverse postorder (postorder
+// for backward problems), so most problems settle in one or two passes.
+
+struct Forward {
+  static const bool backward = false;
+};
+struct Backward {
+  static const bool backward = true;
+};
+
+struct Union {
+  static BitSet top(size_t) { return BitSet(); }
+  static void meet(BitSet &into, const BitSet &from) { into.merge(from); }
+};
+struct Intersect {
+  static BitSet top(size_t universe) { return BitSet::full(universe); }
+  static void meet(BitSet &into, const BitSet &from) { into.intersect(from); }
+};
+
+// Blocks reachable from the entry in reverse postorder, then any
+// unreachable blocks in layout order
+extern std::vector<int> reversePostorder(const Function *function);
+
+template <typename Direction, typename Meet, typename Transfer>
+class Dataflow {
+ public:
+  std::vector<BitSet> in, out; // per block
+
+  // boundary is the set flowing into the entry (forward) or out of the
+  // exit blocks (backward)
+  void solve(const Function *function, size_t universe, Transfer &transfer, const BitSet &boundary);
+};
+
+// Live variables. The sets hold variable numbers (SymbolTable::slot), not
+// symbol ids, so they stay as small as the variable count. Block level sets
+// are solved once; the sets inside a block are rebuilt on demand by walking
+// the block backward.
+class Liveness {
+ public:
+  void compute(const Function *function);
+
+  const BitSet &liveIn(int block) const { return flow.out[block]; }
+  const BitSet &liveOut(int block) const { return flow.in[block]; }
+
+  // Walk a block from its last instruction to its first, calling
+  // fn(index, live) where live holds what is live right after instruction
+  // index.
+  template <typename Fn>
+  void walk(const Block &block, Fn fn) const;
+
+  // Apply one instruction backward: live = (live - def) | uses
+  void step(const IRInstruction &ins, BitSet &live) const;
+
+ private:
+  struct GenKill {
+    std::vector<BitSet> gen, kill;
+    bool operator()(int block, const BitSet &in, BitSet &out) const {
+      return out.transfer(gen[block], in, kill[block]);
+    }
+  };
+
+  const Function *function = nullptr;
+  GenKill sets;
+  Dataflow<Backward, Union, GenKill> flow;
+};
+
+template <typename Direction, typename Meet, typename Transfer>
+void Dataflow<Direction, Meet, Transfer>::solve(const Function *function, size_t universe, Transfer &transfer,
+    const BitSet &boundary) {
+  const std::vector<Block> &blocks = function->blocks;
+  in.assign(blocks.size(), Meet::top(universe));
+  out.assign(blocks.size(), Meet::top(universe));
+
+  std::vector<int> order = reversePostorder(function);
+  if (Direction::backward) {
+    std::reverse(order.begin(), order.end());
+  }
+
+  // FIFO worklist seeded in order; a block is queued at most once
+  std::vector<int> queue(order.begin(), order.end());
+  std::vector<bool> queued(blocks.size(), true);
+  for (size_t head = 0; head < queue.size(); ++head) {
+    int b = queue[head];
+    queued[b] = false;
+    const Block &block = blocks[b];
+    const SmallVector<int, 2> &sources = Direction::backward ? block.next : block.prev;
+    const SmallVector<int, 2> &sinks = Direction::backward ? block.prev : block.next;
+
+    // meet over the incoming edges; blocks with none see the boundary
+    if (sources.empty()) {
+      in[b] = boundary;
+    } else {
+      in[b] = out[sources[0]];
+      for (unsigned int i = 1; i < sources.size(); ++i) {
+        Meet::meet(in[b], out[sources[i]]);
+      }
+    }
+
+    if (transfer(b, in[b], out[b])) {
+      for (int s : sinks) {
+        if (!queued[s]) {
+          queued[s] = true;
+          queue.push_back(s);
+        }
+      }
+    }
+  }
+}
+
+template <typename Fn>
+void Liveness::walk(const Block &block, Fn fn) const {
+  BitSet live = liveOut(block.index);
+  for (int i = block.ins.size() - 1; i >= 0; --i) {
+    fn(i, static_cast<const BitSet &>(live));
+    step(block.ins[i], live);
+  }
+}
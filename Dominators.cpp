@@ -0,0 +1,116 @@
+#include "Dominators.h"
+#include "Dataflow.h"
+#include <algorithm>
+
+int Dominators::common(int a, int b) const {
+  // walk the deeper one up, the entry has the smallest rpo number
+  while (a != b) {
+    while (rpo[a] > rpo[b]) a = idoms[a];
+    while (rpo[b] > rpo[a]) b = idoms[b];
+  }
+  return a;
+}
+
+void Dominators::compute(const Function *function) {
+  const std::vector<Block> &blocks = function->blocks;
+  idoms.assign(blocks.size(), -1);
+  rpo.assign(blocks.size(), -1);
+  pre.assign(blocks.size(), -1);
+  post.assign(blocks.size(), -1);
+  innermost.assign(blocks.size(), -1);
+  parent.assign(blocks.size(), -1);
+  depths.assign(blocks.size(), 0);
+  if (blocks.empty()) return;
+
+  std::vector<int> order = reversePostorder(function);
+  for (size_t i = 0; i < order.size(); ++i) rpo[order[i]] = i;
+
+  // unreachable blocks only have unreachable predecessors, so they keep -1.
+  // idoms[0] is 0 during the solve so the walk in common() stops there.
+  idoms[0] = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (size_t i = 1; i < order.size(); ++i) {
+      int b = order[i];
+      int dom = -1;
+      for (int p : blocks[b].prev) {
+        if (idoms[p] == -1) continue; // not processed yet, or unreachable
+        dom = dom == -1 ? p : common(p, dom);
+      }
+      if (dom != -1 && idoms[b] != dom) {
+        idoms[b] = dom;
+        changed = true;
+      }
+    }
+  }
+  idoms[0] = -1;
+
+  // number the dominator tree so dominates() is two comparisons
+  std::vector<std::vector<int>> children(blocks.size());
+  for (size_t b = 1; b < blocks.size(); ++b) {
+    if (idoms[b] != -1) children[idoms[b]].push_back(b);
+  }
+  int counter = 0;
+  std::vector<std::pair<int, size_t>> stack;
+  stack.emplace_back(0, 0);
+  pre[0] = counter++;
+  while (!stack.empty()) {
+    auto &top = stack.back();
+    if (top.second < children[top.first].size()) {
+      int child = children[top.first][top.second++];
+      pre[child] = counter++;
+      stack.emplace_back(child, 0);
+    } else {
+      post[top.first] = counter++;
+      stack.pop_back();
+    }
+  }
+
+  // natural loops: an edge to a block that dominates its source is a back
+  // edge, and the loop is everything that reaches the source without going
+  // through the header. Back edges to the same header make one loop.
+  std::vector<std::vector<int>> sources(blocks.size()); // per header, its back edges
+  for (const Block &block : blocks) {
+    for (int header : block.next) {
+      if (dominates(header, block.index)) sources[header].push_back(block.index);
+    }
+  }
+  std::vector<std::vector<int>> bodies; // per loop, header first
+  std::vector<int> seen(blocks.size(), -1); // header of the last loop that walked the block
+  for (int header = 0; header < (int) blocks.size(); ++header) {
+    if (sources[header].empty()) continue;
+    std::vector<int> &body = bodies.emplace_back(1, header);
+    seen[header] = header;
+    std::vector<int> work = sources[header];
+    while (!work.empty()) {
+      int b = work.back();
+      work.pop_back();
+      if (seen[b] == header) continue;
+      seen[b] = header;
+      body.push_back(b);
+      for (int p : blocks[b].prev) {
+        if (reachable(p)) work.push_back(p);
+      }
+    }
+  }
+
+  // Loops are nested or apart, so going from the biggest to the smallest
+  // leaves each block with its innermost loop, and each header with the
+  // one around it when its own loop comes up.
+  std::stable_sort(bodies.begin(), bodies.end(), [](const std::vector<int> &a, const std::vector<int> &b) {
+    return a.size() > b.size();
+  });
+  for (const std::vector<int> &body : bodies) {
+    int header = body[0];
+    parent[header] = innermost[header];
+    depths[header] = parent[header] == -1 ? 1 : depths[parent[header]] + 1;
+    for (int b : body) innermost[b] = header;
+  }
+}
+
+bool Dominators::contains(int header, int block) const {
+  for (int h = innermost[block]; h != -1; h = parent[h]) {
+    if (h == header) return true;
+  }
+  return false;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "CFG.h"
+#include <vector>
+
+// Dominator tree of a function's blocks (Cooper, Harvey & Kennedy, "A Simple,
+// Fast Dominance Algorithm"), plus the natural loops and how they nest. Blocks
+// that can't be reached from the entry have no dominator and dominate
+// nothing.
+class Dominators {
+ public:
+  void compute(const Function *function);
+
+  // immediate dominator, -1 for the entry and unreachable blocks
+  int idom(int block) const { return idoms[block]; }
+  bool reachable(int block) const { return block == 0 || idoms[block] != -1; }
+
+  // a dominates b, every block dominates itself
+  bool dominates(int a, int b) const {
+    return reachable(a) && reachable(b) && pre[a] <= pre[b] && post[b] <= post[a];
+  }
+
+  // the closest block that dominates both a and b
+  int common(int a, int b) const;
+
+  // block is in the body of some loop, that is on a path from a loop header
+  // back to itself
+  bool inLoop(int block) const { return innermost[block] != -1; }
+  // the header of the innermost loop around block, -1 if there is none
+  int header(int block) const { return innermost[block]; }
+  // the header of the loop around header's loop, -1 if there is none
+  int outer(int header) const { return parent[header]; }
+  // how many loops block is in
+  int depth(int block) const { return innermost[block] == -1 ? 0 : depths[innermost[block]]; }
+  // block is in the loop that starts at header
+  bool contains(int header, int block) const;
+
+ private:
+  std::vector<int> idoms;
+  std::vector<int> rpo; // position in reverse postorder
+  std::vector<int> pre, post; // dominator tree dfs numbers, for dominates()
+  std::vector<int> innermost; // per block, header of its innermost loop or -1
+  std::vector<int> parent; // per header, the header of the loop around its loop or -1
+  std::vector<int> depths; // per header, how deep its loop is
+};
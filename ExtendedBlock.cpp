@@ -0,0 +1,236 @@
+#include <algorithm>
+
+#include "CFG.h"
+#include "Strategy.h"
+#include "CodeGen.h"
+
+void ExtendedBlock::process(Program *program, Function *cfg) {
+  this->program = program;
+  this->func = cfg;
+  assignments = nullptr;
+  liveness.compute(func);
+  foldConstants(func, liveness);
+  liveness.compute(func);
+
+  // A tree starts at the entry and at every block with several predecessors
+  // (or only itself), and takes in the successors that have no other way in.
+  // A cycle of single predecessors that none of those reach is unreachable;
+  // its first block starts a tree anyway.
+  std::vector<Block> &blocks = func->blocks;
+  root.assign(blocks.size(), -1);
+  std::vector<int> order; // every tree, parents before children
+  auto grow = [&](int start) {
+    root[start] = start;
+    std::vector<int> work { start };
+    while (!work.empty()) {
+      const Block &block = blocks[work.back()];
+      work.pop_back();
+      order.push_back(block.index);
+      for (int n : block.next) {
+        const Block &next = blocks[n];
+        if (root[n] == -1 && n != 0 && next.prev.size() == 1 && next.prev[0] != n) {
+          root[n] = start;
+          work.push_back(n);
+        }
+      }
+    }
+  };
+  for (Block &block : blocks) {
+    if (block.index == 0 || block.prev.size() != 1 || block.prev[0] == block.index) grow(block.index);
+  }
+  for (Block &block : blocks) {
+    if (root[block.index] == -1) grow(block.index);
+  }
+
+  // the variables the tree's blocks read most, counting each read as often
+  // as its block runs, get registers. globals are shared with the functions
+  // it calls, so they stay in memory.
+  dom.compute(func);
+  frequency.compute(func, dom);
+  std::vector<std::map<Sym, double>> uses(blocks.size()); // per root, variable -> weighted reads
+  trees.assign(blocks.size(), std::map<Sym, int>());
+  for (Block &block : blocks) {
+    for (const IRInstruction &ins : block.ins) {
+      for (Sym variable : ins.Uses()) {
+        if (func->isVar(variable) && !program->IsGlobal(func, variable)) uses[root[block.index]][variable] += frequency.of(block.index);
+      }
+    }
+  }
+
+  registers[0] = registers[1] = 0;
+  for (Block &block : blocks) {
+    if (root[block.index] != block.index) continue;
+    std::multimap<double, Sym> rev;
+    for (auto &it : uses[block.index]) {
+      rev.insert(std::make_pair(it.second, it.first));
+    }
+    int idx[2] = { 0, 0 }; // next register of each class
+    for (auto it = rev.rbegin(); it != rev.rend(); ++it) {
+      RegClass c = regClass(it->second);
+      if (idx[int(c)] == target.count(c)) continue;
+      trees[block.index][it->second] = idx[int(c)]++;
+    }
+    for (RegClass c : { RegClass::integer, RegClass::floating }) {
+      registers[int(c)] = std::max(registers[int(c)], idx[int(c)]);
+    }
+  }
+
+  // What needs writing back where the tree is left: the values changed on
+  // the way from the root that weren't written back since. That happens
+  // right before a block's jump, branch or return. Around a call, what is in
+  // the registers it overwrites and read after it is stored if it changed,
+  // and loaded again after the call.
+  saves.clear();
+  restores.clear();
+  dirty.assign(blocks.size(), BitSet());
+  std::vector<BitSet> entering(blocks.size());
+  for (int b : order) {
+    const Block &block = blocks[b];
+    std::vector<BitSet> across(block.ins.size()); // live out of each call
+    liveness.walk(block, [&](int idx, const BitSet &liveout) {
+      if (block.ins[idx].op == OP::call || block.ins[idx].op == OP::callr) across[idx] = liveout;
+    });
+
+    BitSet &d = dirty[b];
+    d = entering[b];
+    for (size_t i = 0; i < block.ins.size(); ++i) {
+      const IRInstruction &ins = block.ins[i];
+      Sym def = ins.Def();
+      if (ins.op == OP::call || ins.op == OP::callr) {
+        uint64_t clobbered = clobbers(func, ins);
+        for (auto &it : trees[root[b]]) {
+          int slot = func->symbols.slot(it.first);
+          if (it.first == def || !across[i].test(slot) || !(clobbered & Target::mask(regClass(it.first), it.second))) continue;
+          if (d.test(slot)) saves[&ins].push_back(it.first);
+          restores[&ins].push_back(it.first);
+          d.erase(slot);
+        }
+      }
+      if (func->isVar(def)) d.insert(func->symbols.slot(def));
+    }
+    BitSet after = d;
+    for (int n : block.next) {
+      if (!inside(b, n)) after.subtract(liveness.liveIn(n));
+    }
+    for (int n : block.next) {
+      if (inside(b, n)) entering[n] = after;
+    }
+  }
+}
+
+void ExtendedBlock::enterBlock(Block *block) {
+  current = block->index;
+  assignments = &trees[root[current]];
+  if (root[current] != current) return; // the registers come from the block before
+
+  // load what is live on the way in, the rest is written before it is read
+  Naive n;
+  n.process(program, func);
+  emit("# start of extended block - loading into registers");
+  const BitSet &live = liveness.liveIn(current);
+  for (auto &it : *assignments) {
+    const std::string &r = registerOf(it.first);
+    emit("# variable " + func->symbols.name(it.first) + " is assigned register " + r);
+    if (live.test(func->symbols.slot(it.first))) n.reg(it.first, r);
+  }
+}
+
+void ExtendedBlock::exitBlock(Block *block) {
+  // blocks of the same tree carry on with the registers. Whatever the tree
+  // changed goes back to memory for the others, if they need it.
+  BitSet live;
+  bool leaves = false;
+  for (int n : block->next) {
+    if (inside(block->index, n)) continue;
+    live.merge(liveness.liveIn(n));
+    leaves = true;
+  }
+  if (!leaves) return;
+
+  emit("# begin spilling");
+  Naive n;
+  n.process(program, func);
+  for (auto &it : *assignments) {
+    int slot = func->symbols.slot(it.first);
+    if (dirty[block->index].test(slot) && live.test(slot)) n.store(registerOf(it.first), it.first);
+  }
+  emit("# end of block");
+}
+
+void ExtendedBlock::spill(Block *block, IRInstruction *ins) {
+  emit("# spilling for jal");
+  auto it = saves.find(ins);
+  if (it == saves.end()) return;
+  Naive n;
+  n.process(program, func);
+  for (Sym variable : it->second) n.store(registerOf(variable), variable);
+}
+
+void ExtendedBlock::unspill(Block *block, IRInstruction *ins) {
+  emit("# unspilling");
+  auto it = restores.find(ins);
+  if (it == restores.end()) return;
+  Naive n;
+  n.process(program, func);
+  for (Sym variable : it->second) n.reg(variable, registerOf(variable));
+}
+
+std::vector<std::string> ExtendedBlock::savedRegisters() {
+  std::vector<std::string> saved;
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int i = 0; i < registers[int(c)]; ++i) {
+      if (target.calleeSaved(c, i)) saved.push_back(target.name(c, i));
+    }
+  }
+  return saved;
+}
+
+std::string ExtendedBlock::registerOf(Sym variable) const {
+  if (assignments == nullptr) return ""; // the parameters are stored before the first block
+  auto it = assignments->find(variable);
+  return it == assignments->end() ? "" : target.name(regClass(variable), it->second);
+}
+
+std::string ExtendedBlock::reg(Sym variable, const std::string &suggestion) {
+  std::string r = registerOf(variable);
+  if (!r.empty()) {
+    if (suggestion.find("$a") == 0 || suggestion.find("$v") == 0 || suggestion == "$f12") {
+      // if the target is a function parameter or return value, then we just do a move
+      move(suggestion, r, "# move of " + func->symbols.name(variable) + " to fn arg/ret");
+    }
+    return r;
+  }
+
+  Naive n;
+  n.process(program, func);
+  return n.reg(variable, suggestion);
+}
+
+void ExtendedBlock::store(const std::string &reg, Sym variable) {
+  std::string r = registerOf(variable);
+  if (!r.empty()) {
+    if (reg[0] != '$') {
+      // not a register
+      loadImmediate(r, reg);
+    } else if (reg != r) {
+      move(r, reg);
+    }
+    return;
+  }
+
+  Naive n;
+  n.process(program, func);
+  return n.store(reg, variable);
+}
+
+void ExtendedBlock::emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) {
+  std::string r = registerOf(dest);
+  if (!r.empty()) {
+    emit(op, r, a2, a3);
+    return;
+  }
+
+  Naive n;
+  n.process(program, func);
+  return n.emitAndStore(op, dest, a2, a3);
+}
@@ -0,0 +1,63 @@
+#include "FrameLayout.h"
+
+FrameLayout layout;
+
+void FrameLayout::compute(const Function *function, const BitSet &memory) {
+  const SymbolTable &symbols = function->symbols;
+  offsets.assign(symbols.size(), -1);
+  count = 0;
+  if (memory.empty()) return;
+
+  // Variables in memory need words of their own while they are live at the
+  // same time. Like the register interference graph: a def interferes with
+  // whatever is live after it (a copy's source holds the same value, so it
+  // can share), and everything live on entry, parameters included, is
+  // defined there at once.
+  // Only first fit walks the edges, so they are kept as plain lists, with
+  // duplicates.
+  Liveness liveness;
+  liveness.compute(function);
+  std::vector<std::vector<int>> graph(symbols.numVariables());
+  auto addEdge = [&](int a, int b) {
+    if (a == b) return;
+    graph[a].push_back(b);
+    graph[b].push_back(a);
+  };
+  for (const Block &block : function->blocks) {
+    liveness.walk(block, [&](int idx, const BitSet &liveout) {
+      const IRInstruction &ins = block.ins[idx];
+      Sym def = ins.Def();
+      if (!function->isVar(def) || !memory.test(symbols.slot(def))) return;
+      Sym source = ins.op == OP::assign && ins.arg3 == NO_SYM ? ins.arg2 : NO_SYM;
+      liveout.for_each([&](int slot) {
+        if (memory.test(slot) && symbols.variable(slot) != source) addEdge(symbols.slot(def), slot);
+      });
+    });
+  }
+  BitSet entry = liveness.liveIn(0);
+  for (Sym param : function->intparams) entry.insert(symbols.slot(param));
+  std::vector<int> defined;
+  entry.for_each([&](int slot) {
+    if (memory.test(slot)) defined.push_back(slot);
+  });
+  for (size_t i = 0; i < defined.size(); ++i) {
+    for (size_t j = 0; j < i; ++j) addEdge(defined[i], defined[j]);
+  }
+
+  // first fit, in declaration order
+  std::vector<int> word(symbols.numVariables(), -1);
+  std::vector<int> taken; // per word, the last variable a neighbor of which has it
+  memory.for_each([&](int slot) {
+    for (int other : graph[slot]) {
+      if (word[other] != -1) taken[word[other]] = slot;
+    }
+    int w = 0;
+    while (w < count && taken[w] == slot) ++w;
+    if (w == count) {
+      ++count;
+      taken.push_back(-1);
+    }
+    word[slot] = w;
+    offsets[symbols.variable(slot)] = 4 * w;
+  });
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "CFG.h"
+#include "Dataflow.h"
+#include <vector>
+
+// Where the variables that live in memory go in the stack frame, worked out
+// once per function after allocation. Each of them gets a word, but
+// variables that are never live at the same time share one (stack slot
+// coloring), so the frame only grows with how much memory is live at once.
+// Variables the allocator kept in registers get nothing.
+class FrameLayout {
+ public:
+  // memory holds the slots (SymbolTable::slot) of the variables the
+  // generated code may load or store
+  void compute(const Function *function, const BitSet &memory);
+
+  // words used by variables, from 0($sp) up
+  int words() const { return count; }
+  // byte offset from $sp, -1 if the variable has no stack slot
+  int offset(Sym variable) const { return variable >= 0 && variable < (int) offsets.size() ? offsets[variable] : -1; }
+
+ private:
+  std::vector<int> offsets; // by symbol
+  int count = 0;
+};
+
+// the layout of the function being generated
+extern FrameLayout layout;
@@ -0,0 +1,114 @@
+#include "Frequency.h"
+#include "Dataflow.h"
+#include <algorithm>
+
+// The chance of taking each of the block's edges, in the order of
+// Block::next. A branch falls through to next[0] and jumps to next[1]. Each
+// heuristic that applies is a guess at the chance of the jump, and the
+// guesses are combined the way Wu & Larus do it (Dempster-Shafer) instead of
+// letting the first one decide.
+static SmallVector<double, 2> probabilities(const Function *function, const Dominators &dom, const Block &block) {
+  SmallVector<double, 2> p;
+  if (block.next.size() != 2) {
+    for (unsigned i = 0; i < block.next.size(); ++i) p.push_back(1.0 / block.next.size());
+    return p;
+  }
+
+  const std::vector<Block> &blocks = function->blocks;
+  int fall = block.next[0], jump = block.next[1];
+  double taken = 0.5;
+  auto apply = [&](double guess) {
+    taken = taken * guess / (taken * guess + (1 - taken) * (1 - guess));
+  };
+  auto heuristic = [&](auto test, double guess) {
+    bool a = test(jump), b = test(fall);
+    if (a != b) apply(a ? guess : 1 - guess);
+  };
+
+  // loop branch: staying in the loop, back edges included
+  int header = dom.header(block.index);
+  heuristic([&](int s) { return header != -1 && dom.contains(header, s); }, 0.88);
+  // loop header: going into a loop
+  heuristic([&](int s) { return dom.header(s) == s && !dom.dominates(s, block.index); }, 0.75);
+  // call: calls are mostly off the common path, such as error reporting
+  heuristic([&](int s) {
+    return std::any_of(blocks[s].ins.begin(), blocks[s].ins.end(), [](const IRInstruction &ins) {
+      return ins.op == OP::call || ins.op == OP::callr;
+    });
+  }, 0.22);
+  // return: returning early is unlikely
+  heuristic([&](int s) { return blocks[s].ins.back().op == OP::_return; }, 0.28);
+
+  // opcode: things are rarely equal, and rarely below zero
+  const IRInstruction &branch = block.ins.back();
+  bool zero = branch.arg2 != NO_SYM && function->symbols.kind(branch.arg2) == SymKind::imm_int &&
+    function->symbols.name(branch.arg2) == "0";
+  if (branch.op == OP::breq) apply(0.16);
+  if (branch.op == OP::brneq) apply(0.84);
+  if (zero && (branch.op == OP::brlt || branch.op == OP::brleq)) apply(0.16);
+  if (zero && (branch.op == OP::brgt || branch.op == OP::brgeq)) apply(0.84);
+
+  p.push_back(1 - taken);
+  p.push_back(taken);
+  return p;
+}
+
+void BlockFrequency::compute(const Function *function, const Dominators &dom) {
+  const std::vector<Block> &blocks = function->blocks;
+  freq.assign(blocks.size(), 0);
+  if (blocks.empty()) return;
+
+  std::vector<SmallVector<double, 2>> prob(blocks.size()), edges(blocks.size());
+  for (const Block &block : blocks) {
+    prob[block.index] = probabilities(function, dom, block);
+    for (unsigned i = 0; i < block.next.size(); ++i) edges[block.index].push_back(0);
+  }
+
+  // each loop's blocks in reverse postorder, so the edges into a block are
+  // done before it, back edges aside
+  std::vector<int> order = reversePostorder(function);
+  std::vector<std::vector<int>> loops(blocks.size()); // by header
+  for (int b : order) {
+    for (int h = dom.header(b); h != -1; h = dom.outer(h)) loops[h].push_back(b);
+  }
+
+  // Frequencies relative to the region's head (a loop header, or the entry
+  // for the whole function) running once. A loop header inside it was done
+  // already, and runs 1 / (1 - back) times per entry. Stops short of 1, a
+  // loop with no way out still runs a finite number of times here.
+  std::vector<double> back(blocks.size(), 0); // per header, the chance of coming back around
+  auto propagate = [&](int head, const std::vector<int> &region) {
+    for (int b : region) {
+      double f = 0;
+      if (b == region[0]) {
+        f = 1;
+      } else {
+        for (int p : blocks[b].prev) {
+          if (dom.dominates(b, p)) continue; // a back edge
+          for (unsigned i = 0; i < blocks[p].next.size(); ++i) {
+            if (blocks[p].next[i] == b) f += edges[p][i];
+          }
+        }
+      }
+      if (b != head) f /= 1 - back[b];
+      freq[b] = f;
+      for (unsigned i = 0; i < blocks[b].next.size(); ++i) edges[b][i] = f * prob[b][i];
+    }
+    if (head == -1) return;
+    double p = 0;
+    for (int b : region) {
+      for (unsigned i = 0; i < blocks[b].next.size(); ++i) {
+        if (blocks[b].next[i] == head) p += edges[b][i];
+      }
+    }
+    back[head] = std::min(p, 0.99);
+  };
+
+  std::vector<int> headers;
+  for (int h = 0; h < (int) blocks.size(); ++h) {
+    if (!loops[h].empty()) headers.push_back(h);
+  }
+  std::stable_sort(headers.begin(), headers.end(), [&](int a, int b) { return dom.depth(a) > dom.depth(b); });
+  for (int h : headers) propagate(h, loops[h]);
+  propagate(-1, order);
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "CFG.h"
+#include "Dominators.h"
+#include <vector>
+
+// How often each block runs per call of its function, estimated from the
+// code alone (Wu & Larus, "Static Branch Frequency and Program Profile
+// Analysis"). Every branch gets a probability from the Ball & Larus
+// heuristics that apply to it, and the probabilities are carried from the
+// entry down the edges, innermost loops first: a loop header runs 1 / (1 - p)
+// times for each time the loop is entered, p being the chance of coming
+// back around. The entry runs once, unreachable blocks never.
+class BlockFrequency {
+ public:
+  void compute(const Function *function, const Dominators &dom);
+
+  double of(int block) const { return freq[block]; }
+
+ private:
+  std::vector<double> freq;
+};
@@ -1,328 +1,674 @@
-#include <iostream>
 #include <algorithm>
-#include <stack>
+#include <numeric>
 
 #include "CFG.h"
 #include "Strategy.h"
 #include "CodeGen.h"
 
 void Global::performLivenessAnalysis() {
-    Block *currBlock = this->func->start; // start at first block in function
-    IRInstruction * currIns;
-    while(currBlock != nullptr){
-        for(int i = 0; i < currBlock->ins.size(); i++){
-            currIns = &(currBlock->ins[i]);
-            switch (currIns->op){
-                case OP::assign:
-                    // Variable assignment
-                    if(currIns->arg3.empty()){
-                        if(func->isVar(currIns->arg1)){
-                            currIns->defs.insert(currIns->arg1);
-                        }
-                        if(func->isVar(currIns->arg2)){
-                            currIns->uses.insert(currIns->arg2);
-                        }
-                    }
-                        // Array assignment
-                    else {
-                        if(func->isVar(currIns->arg1)){
-                            currIns->defs.insert(currIns->arg1);
-                        }
-                        if(func->isVar(currIns->arg2)){
-                            currIns->uses.insert(currIns->arg2);
-                        }
-                        if(func->isVar(currIns->arg3)){
-                            currIns->uses.insert(currIns->arg3);
-                        }
-                    }
-                    break;
-                case OP::add:
-                case OP::sub:
-                case OP::mult:
-                case OP::div:
-                case OP::_and:
-                case OP::_or:
-                    if(func->isVar(currIns->arg1)){
-                        currIns->uses.insert(currIns->arg1);
-                    }
-                    if(func->isVar(currIns->arg2)){
-                        currIns->uses.insert(currIns->arg2);
-                    }
-                    if(func->isVar(currIns->arg3)){
-                        currIns->defs.insert(currIns->arg3);
-                    }
-                case OP::_goto:
-                    // UNUSED, no def or use
-                    break;
-                case OP::breq:
-                case OP::brneq:
-                case OP::brlt:
-                case OP::brgt:
-                case OP::brgeq:
-                case OP::brleq:
-                    if(func->isVar(currIns->arg1)){
-                        currIns->uses.insert(currIns->arg1);
-                    }
-                    if(func->isVar(currIns->arg2)){
-                        currIns->uses.insert(currIns->arg2);
-                    }
-                    break;
-                case OP::_return:
-                    if(func->isVar(currIns->arg1)){
-                        currIns->uses.insert(currIns->arg1);
-                    }
-                    break;
-                case OP::call:
-                    if(func->isVar(currIns->arg2)){
-                        currIns->uses.insert(currIns->arg2);
-                    }
-                    if(func->isVar(currIns->arg3)){
-                        currIns->uses.insert(currIns->arg3);
-                    }
-                    break;
-                case OP::callr:
-                    // TODO implement
-                    break;
-                case OP::array_store:
-                    // TODO implement
-                    break;
-                case OP::array_load:
-                    // TODO implement
-                    break;
-                default:
-                    // not def or use
-                    break;
-            }
-        }
-        currBlock = currBlock->after; // go to next block
+  liveness.compute(func);
+}
+
+// The front end reuses names such as $temp1 for unrelated values. Give each
+// web its own variable, so they get their own registers: a web is the union
+// of the du-chains that share a use. Rather than solving reaching
+// definitions over every def, the chains are followed through the live-in
+// points of the blocks (reaching definitions pruned by liveness): each
+// live-in value is a node, joined with whatever reaches the end of each
+// predecessor, and a use joins whichever node its variable holds at that
+// point.
+void Global::splitWebs() {
+  const SymbolTable &symbols = func->symbols;
+  int variables = symbols.numVariables();
+
+  // globals are shared between functions
+  fixed.clear();
+  for (int slot = 0; slot < variables; ++slot) {
+    if (program->IsGlobal(func, symbols.variable(slot))) fixed.insert(slot);
+  }
+
+  // node numbers: the live-in values of each block, then the defs
+  std::vector<std::vector<int>> liveIn(func->blocks.size()); // slots, sorted
+  std::vector<int> first(func->blocks.size()); // node of liveIn[b][0]
+  int count = 0;
+  for (Block &block : func->blocks) {
+    first[block.index] = count;
+    liveness.liveIn(block.index).for_each([&](int slot) {
+      if (!fixed.test(slot)) liveIn[block.index].push_back(slot);
+    });
+    count += liveIn[block.index].size();
+  }
+  auto entering = [&](int block, int slot) {
+    const std::vector<int> &in = liveIn[block];
+    return first[block] + int(std::lower_bound(in.begin(), in.end(), slot) - in.begin());
+  };
+
+  std::vector<int> parent(count);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&](int node) {
+    while (parent[node] != node) node = parent[node] = parent[parent[node]];
+    return node;
+  };
+
+  // every renameable operand and the node it belongs to
+  std::vector<std::pair<Sym *, int>> operands;
+  std::vector<int> current(variables); // node each variable holds
+  std::vector<int> stamp(variables, -1); // block current was set in
+  for (Block &block : func->blocks) {
+    auto holding = [&](int slot) {
+      return stamp[slot] == block.index ? current[slot] : entering(block.index, slot);
+    };
+
+    for (IRInstruction &ins : block.ins) {
+      for (Sym *used : ins.UseOperands()) {
+        if (!func->isVar(*used)) continue;
+        int slot = symbols.slot(*used);
+        if (!fixed.test(slot)) operands.push_back(std::make_pair(used, holding(slot)));
+      }
+
+      Sym *def = ins.DefOperand();
+      if (def != nullptr && func->isVar(*def) && !fixed.test(symbols.slot(*def))) {
+        int slot = symbols.slot(*def);
+        parent.push_back(count);
+        current[slot] = count++;
+        stamp[slot] = block.index;
+        operands.push_back(std::make_pair(def, current[slot]));
+      }
     }
 
-    // calculate in / out
-    bool changed = true;
-    while (changed) {
-      changed = false;
-
-      for (Block *block = func->start; block; block = block->after) {
-        for (unsigned int idx = 0; idx < block->ins.size(); ++idx) {
-          IRInstruction &ins = block->ins[idx];
-
-          std::vector<IRInstruction *> next;
-          if (idx + 1 == block->ins.size()) {
-            for (Block *succ : block->next) {
-              next.push_back(&succ->ins[0]);
-            }
-          } else {
-            next.push_back(&block->ins[idx + 1]);
-          }
-
-          // liveout(n) = for each m in succ(n) : (uevar(m) u (liveout(m) - varkill(m)))
-          std::set<std::string> liveout;
-          for (IRInstruction *succ : next) {
-            std::set<std::string> lo = succ->liveout;
-            // remove things we killed
-            for (std::string kill : succ->defs) {
-              lo.erase(kill);
-            }
-
-            // union with uses
-            for (std::string use : succ->uses) {
-              lo.insert(use);
-            }
-
-            // union into running liveout
-            for (std::string l : lo) liveout.insert(l);
-          }
-          if (ins.liveout != liveout) {
-            ins.liveout = liveout; // apply
-            changed = true;
-          }
-        }
+    // what leaves this block is what enters the next ones
+    for (int next : block.next) {
+      for (int slot : liveIn[next]) {
+        int a = find(entering(next, slot)), b = find(holding(slot));
+        if (a != b) parent[a] = b;
       }
     }
+  }
+
+  // the web live on entry keeps the name, the parameters are stored there
+  std::vector<Sym> name(count, NO_SYM);
+  for (int slot : liveIn[0]) {
+    name[find(entering(0, slot))] = symbols.variable(slot);
+  }
+  BitSet named;
+  for (int slot : liveIn[0]) named.insert(slot);
+
+  for (auto &operand : operands) {
+    Sym variable = *operand.first;
+    int web = find(operand.second);
+    if (name[web] == NO_SYM) {
+      int slot = symbols.slot(variable);
+      if (!named.test(slot)) {
+        // the first web seen keeps the name
+        name[web] = variable;
+        named.insert(slot);
+      } else {
+        name[web] = func->symbols.temp(symbols.kind(variable), symbols.name(variable));
+      }
+    }
+    *operand.first = name[web];
+  }
+}
 
-#if 0
-  std::cout << "LIVEOUT " << func->name << std::endl;
-  for (Block *block = func->start; block; block = block->after) {
-    std::cout << "BLOCK LIVEOUT " << block << std::endl;
-    for (std::string l : block->liveout) {
-      std::cout << " " << l << std::endl;
+// Conservative coalescing: webs joined by a copy that don't interfere become
+// one variable and the copy goes away, as long as the merged web is sure to
+// still get a register. That holds if it has fewer than K neighbors with K or
+// more neighbors of their own (Briggs), or if every neighbor of one web
+// already interferes with the other or has fewer than K neighbors (George).
+// Merged webs take over each other's edges, so a chain of copies can fold
+// into one variable in a single pass.
+void Global::coalesce() {
+  auto copy = [&](const IRInstruction &ins) {
+    return ins.op == OP::assign && ins.arg3 == NO_SYM && func->isVar(ins.arg1) && func->isVar(ins.arg2) &&
+      func->isFloat(ins.arg1) == func->isFloat(ins.arg2);
+  };
+  bool any = false;
+  for (Block &block : func->blocks) {
+    any = any || std::any_of(block.ins.begin(), block.ins.end(), copy);
+  }
+  if (!any) return; // not worth building the graph for
+
+  performLivenessAnalysis();
+  buildWebs();
+  buildInterferenceGraph();
+
+  std::vector<int> parent(nodes.size());
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&](int node) {
+    while (parent[node] != node) node = parent[node] = parent[parent[node]];
+    return node;
+  };
+  // degrees still count webs merged away, which only makes the tests stricter.
+  // webs only interfere with webs of their own class.
+  auto K = [&](int node) { return target.count(nodes[node].regClass); };
+  auto significant = [&](int node, int drop) { return graph.degree(node) - drop >= K(node); };
+  auto briggs = [&](int a, int b) {
+    int high = 0;
+    for (int n : graph.neighbors(a)) {
+      if (find(n) == n && significant(n, graph.interferes(n, b))) ++high;
+    }
+    for (int n : graph.neighbors(b)) {
+      if (find(n) == n && !graph.interferes(n, a) && significant(n, 0)) ++high;
+    }
+    return high < K(a);
+  };
+  auto george = [&](int a, int b) {
+    for (int n : graph.neighbors(a)) {
+      if (find(n) == n && significant(n, 0) && !graph.interferes(n, b)) return false;
     }
-    std::cout << "BLOCK USES" << std::endl;
-    for (std::string u : block->GetUses()) {
-      std::cout << " " <<u << std::endl;
+    return true;
+  };
+  auto movable = [&](Sym variable) {
+    return !fixed.test(func->symbols.slot(variable)) && webs[variable] != nullptr;
+  };
+  auto param = [&](int node) {
+    return std::find(func->intparams.begin(), func->intparams.end(), nodes[node].name) != func->intparams.end();
+  };
+
+  bool merged = false;
+  for (Block &block : func->blocks) {
+    for (IRInstruction &ins : block.ins) {
+      if (!copy(ins) || !movable(ins.arg1) || !movable(ins.arg2)) continue;
+      int a = find(webs[ins.arg2]->id), b = find(webs[ins.arg1]->id);
+      if (a == b || graph.interferes(a, b)) continue;
+      // parameters are stored to their own name on entry
+      if (param(a) && param(b)) continue;
+      if (!briggs(a, b) && !george(a, b) && !george(b, a)) continue;
+
+      int keep = param(b) ? b : a, gone = keep == a ? b : a;
+      for (int n : graph.neighbors(gone)) {
+        if (find(n) == n) graph.addEdge(keep, n);
+      }
+      parent[gone] = keep;
+      merged = true;
+    }
+  }
+  if (!merged) return;
+
+  for (Block &block : func->blocks) {
+    std::vector<IRInstruction> code;
+    code.reserve(block.ins.size());
+    Sym label = NO_SYM; // of a copy that went away
+    for (IRInstruction &ins : block.ins) {
+      auto rename = [&](Sym *operand) {
+        if (func->isVar(*operand) && webs[*operand] != nullptr) *operand = nodes[find(webs[*operand]->id)].name;
+      };
+      for (Sym *used : ins.UseOperands()) rename(used);
+      if (Sym *def = ins.DefOperand()) rename(def);
+
+      if (ins.op == OP::assign && ins.arg3 == NO_SYM && ins.arg1 == ins.arg2 && &ins != &block.ins.back()) {
+        if (ins.label != NO_SYM) label = ins.label;
+        continue;
+      }
+      if (label != NO_SYM) {
+        ins.label = label;
+        label = NO_SYM;
+      }
+      code.push_back(ins);
     }
-    std::cout << "BLOCK DEFS" << std::endl;
-    for (std::string u : block->GetDefs()) {
-      std::cout << " "<< u << std::endl;
+    block.ins = std::move(code);
+  }
+}
+
+// A value made for one call argument or a return, right before it in the
+// same block with no call in between, is computed straight into $aN or $v0
+// instead of getting its own register and a move. The kept parameter in the
+// same $a register can't be live at that point.
+void Global::passInPlace() {
+  outgoing.clear();
+  const SymbolTable &symbols = func->symbols;
+  std::vector<int> refs(symbols.size(), 0); // defs and uses of each variable
+  for (Block &block : func->blocks) {
+    for (const IRInstruction &ins : block.ins) {
+      if (func->isVar(ins.Def())) refs[ins.Def()]++;
+      for (Sym used : ins.Uses()) {
+        if (func->isVar(used)) refs[used]++;
+      }
     }
-    std::cout << "BLOCK INS" << std::endl;
-    for (IRInstruction &ins : block->ins) {
-      std::cout << op_to_str(ins.op) << std::endl;
+  }
+  std::map<std::string, Sym> kept; // register -> parameter in it
+  for (auto &it : incoming) kept[it.second] = it.first;
+
+  for (Block &block : func->blocks) {
+    std::unordered_map<Sym, int> defined; // variable -> index of its def in this block
+    std::unordered_map<int, std::pair<Sym, std::string>> candidates; // by def index
+    int lastCall = -1;
+    auto candidate = [&](Sym variable, const std::string &r) {
+      if (!func->isInt(variable) || refs[variable] != 2 || fixed.test(symbols.slot(variable)) || incoming.count(variable)) return;
+      auto def = defined.find(variable);
+      if (def != defined.end() && def->second >= lastCall) candidates[def->second] = std::make_pair(variable, r);
+    };
+    for (int idx = 0; idx < (int) block.ins.size(); ++idx) {
+      const IRInstruction &ins = block.ins[idx];
+      if (ins.op == OP::call || ins.op == OP::callr) {
+        bool isfloat = floatCall(func, ins);
+        for (int i = 0; i < ins.NumArgs() && i < 4 && !isfloat; ++i) candidate(ins.Arg(i), "$a" + std::to_string(i));
+        lastCall = idx;
+      } else if (ins.op == OP::_return && ins.arg1 != NO_SYM) {
+        candidate(ins.arg1, "$v0");
+      }
+      if (func->isVar(ins.Def())) defined[ins.Def()] = idx;
     }
+    if (candidates.empty()) continue;
+
+    liveness.walk(block, [&](int idx, const BitSet &liveout) {
+      auto it = candidates.find(idx);
+      if (it == candidates.end()) return;
+      auto param = kept.find(it->second.second);
+      if (param != kept.end() && liveout.test(symbols.slot(param->second))) return;
+      outgoing[it->second.first] = it->second.second;
+    });
   }
-#endif
 }
 
 void Global::buildWebs() {
-  webs.clear();
+  webs.assign(func->symbols.size(), nullptr);
+  nodes.clear();
+
+  auto web = [&](Sym variable) {
+    Web* &w = webs[variable]; // each variable gets a web
+    if (w == nullptr) {
+      w = &nodes.emplace_back();
+      w->id = nodes.size() - 1;
+      w->name = variable;
+      w->regClass = func->isFloat(variable) ? RegClass::floating : RegClass::integer;
+    }
+    return w;
+  };
+  auto allocatable = [&](Sym variable) {
+    // global variables don't get assigned registers, and parameters left in
+    // their $a register don't need one
+    return !program->IsGlobal(func, variable) && !spilled.test(variable) && incoming.count(variable) == 0 &&
+      outgoing.count(variable) == 0;
+  };
+
+  for (Block &block : func->blocks) {
+    liveness.walk(block, [&](int idx, const BitSet &liveout) {
+      IRInstruction &ins = block.ins[idx];
+      Sym def = ins.Def();
+      // registers the call overwrites, none for a syscall
+      uint64_t clobbered = ins.op == OP::call || ins.op == OP::callr ? clobbers(func, ins) : 0;
+      liveout.for_each([&](int slot) {
+        Sym variable = func->symbols.variable(slot);
+        if (!allocatable(variable)) return;
+        Web *w = web(variable);
+        w->ins.insert(&ins);
+        if (clobbered && variable != def) {
+          w->calls += dom.inLoop(block.index) ? 2 : 1;
+          w->clobbered |= clobbered;
+        }
+      });
 
-  for (Block *block = func->start; block; block = block->after) {
-    for (IRInstruction &ins : block->ins) {
-      for (std::string variable : ins.liveout) {
-        if (program->IsGlobal(variable)) continue; // global variables don't get assigned registers
+      // a dead def still needs somewhere to go
+      if (func->isVar(def) && allocatable(def)) web(def);
+    });
+  }
 
-        Web* &w = webs[variable]; // each variable gets a web
-        if (w == nullptr) {
-          w = new Web();
-          w->name = variable;
-        }
-        w->ins.insert(&ins);
+  // spill cost: every def and use of a spilled web becomes a load or store,
+  // except that a constant is never stored, and runs as often as its block
+  for (Block &block : func->blocks) {
+    double f = frequency.of(block.index);
+    for (const IRInstruction &ins : block.ins) {
+      Sym def = ins.Def();
+      if (func->isVar(def) && webs[def] != nullptr && !constants.count(def)) webs[def]->cost += f;
+      for (Sym used : ins.Uses()) {
+        if (func->isVar(used) && webs[used] != nullptr) webs[used]->cost += f;
       }
     }
   }
 }
 
 void Global::buildInterferenceGraph() {
-  // each vertex in the graph is a web
-  // each edge is an interference
-  for (auto &it : webs) {
-    Web *w1 = it.second;
-
-    for (auto &it2 : webs) {
-      Web *w2 = it2.second;
-
-      if (w1 == w2) continue;
-
-      // test if webs intersect
-      std::vector<IRInstruction *> out(w1->ins.size() + w2->ins.size());
-      std::set_intersection(w1->ins.begin(), w1->ins.end(),
-          w2->ins.begin(), w2->ins.end(), out.begin());
-      if (!out.empty()) {
-        w1->edges.insert(w2);
-        w2->edges.insert(w1);
-        std::cout << "INTERFERENCE EDGE " << w1 << " " << w2 << std::endl;
+  // each vertex in the graph is a web, each edge is an interference.
+  // a web interferes with everything live right after one of its defs, so
+  // walk each block backwards and add edges only at the defs. int and float
+  // webs never compete for a register.
+  graph.reset(nodes.size());
+  auto interfere = [&](int a, int b) {
+    if (nodes[a].regClass == nodes[b].regClass) graph.addEdge(a, b);
+  };
+
+  for (Block &block : func->blocks) {
+    liveness.walk(block, [&](int idx, const BitSet &liveout) {
+      const IRInstruction &ins = block.ins[idx];
+      Sym def = ins.Def();
+      if (!func->isVar(def) || webs[def] == nullptr) return;
+
+      // a copy doesn't make the source interfere with the dest, they hold
+      // the same value
+      Sym source = NO_SYM;
+      if (ins.op == OP::assign && ins.arg3 == NO_SYM) source = ins.arg2;
+
+      int node = webs[def]->id;
+      if (source != NO_SYM && webs[source] != nullptr && webs[source]->regClass == webs[def]->regClass) {
+        webs[def]->copies.push_back(webs[source]->id);
+        webs[source]->copies.push_back(node);
       }
+      liveout.for_each([&](int slot) {
+        Sym variable = func->symbols.variable(slot);
+        if (variable == source || webs[variable] == nullptr) return;
+        interfere(node, webs[variable]->id);
+      });
+    });
+  }
+
+  // the parameters are all defined at once on entry, along with whatever
+  // else is live there
+  std::vector<int> entry;
+  liveness.liveIn(0).for_each([&](int slot) {
+    Sym variable = func->symbols.variable(slot);
+    if (webs[variable] != nullptr) entry.push_back(webs[variable]->id);
+  });
+  for (Sym param : func->intparams) {
+    if (webs[param] != nullptr && !liveness.liveIn(0).test(func->symbols.slot(param))) {
+      entry.push_back(webs[param]->id);
     }
   }
+  for (size_t i = 0; i < entry.size(); ++i) {
+    for (size_t j = 0; j < i; ++j) interfere(entry[i], entry[j]);
+  }
 }
 
-void Global::color() {
-  std::vector<Web *> webs;
-  for (auto &it : this->webs) webs.push_back(it.second);
-
-  std::stack<Web *> stack;
-  // remove nodes that have degree <n
-  for (auto it = webs.begin(); it != webs.end();) {
-    Web *web = *it;
+// Chaitin-Briggs coloring. Simplify removes webs with fewer neighbors than
+// there are registers of their class; when there are none left it
+// optimistically removes the web with the lowest cost per neighbor instead.
+// Select then pops the webs back off in reverse and gives each a color its
+// neighbors don't have. Webs that end up without one are returned in spills.
+bool Global::color(std::vector<Sym> &spills) {
+  auto K = [&](int node) { return target.count(nodes[node].regClass); };
+  int count = nodes.size();
+  std::vector<int> degree(count);
+  std::vector<bool> removed(count, false);
+  std::vector<int> low; // webs that can be simplified
+  for (int i = 0; i < count; ++i) {
+    degree[i] = graph.degree(i);
+    if (degree[i] < K(i)) low.push_back(i);
+  }
 
-    if (web->degree() < MAX_REGISTERS) {
-      stack.push(web);
-      it = webs.erase(it);
+  std::vector<int> stack;
+  stack.reserve(count);
+  while ((int) stack.size() < count) {
+    int node = -1;
+    if (!low.empty()) {
+      node = low.back();
+      low.pop_back();
     } else {
-      ++it;
+      // everything left has >= n neighbors, pick the cheapest one to spill.
+      // spill temporaries can't get any shorter, so they go last.
+      double best = 0;
+      for (int i = 0; i < count; ++i) {
+        if (removed[i]) continue;
+        double cost = temps.test(nodes[i].name) ? 1e30 : nodes[i].cost;
+        cost /= degree[i];
+        if (node == -1 || cost < best) {
+          node = i;
+          best = cost;
+        }
+      }
     }
-  }
 
-  // remaining are only webs with degree >= n.
-  // we're supposed to push them based on 'spill cost'
-  for (Web *w : webs) {
-    stack.push(w);
+    removed[node] = true;
+    stack.push_back(node);
+    for (int other : graph.neighbors(node)) {
+      if (!removed[other] && degree[other]-- == K(other)) low.push_back(other);
+    }
   }
-  webs.clear();
 
   while (!stack.empty()) {
-    Web *web = stack.top();
-    stack.pop();
+    Web &web = nodes[stack.back()];
+    stack.pop_back();
 
     // Color based on neighbors
-    for (int i = 0; i < MAX_REGISTERS; ++i) {
-      for (Web *other : web->edges) {
-        if (other->color == i) {
-          // color is already used
-          goto cont;
+    uint64_t used = 0;
+    for (int other : graph.neighbors(web.id)) {
+      if (nodes[other].color != -1) used |= uint64_t(1) << nodes[other].color;
+    }
+    // first a caller saved register none of the calls it is live across
+    // touch, which costs nothing. Otherwise values live across calls go
+    // where the calls leave them alone, everything else leaves those
+    // registers free. Across just one call outside a loop, saving around the
+    // call costs no more than saving in the prologue, and only on the path
+    // that makes the call. Among equally good registers, one a copy partner
+    // already has makes the copy free.
+    auto partner = [&](int reg) {
+      for (int other : web.copies) {
+        if (nodes[other].color == reg) return true;
+      }
+      return false;
+    };
+    for (int pass = 0; pass < 3 && web.color == -1; ++pass) {
+      for (int i = 0; i < K(web.id); ++i) {
+        if (used & (uint64_t(1) << i)) continue;
+        bool saved = target.calleeSaved(web.regClass, i);
+        if (pass == 0 && (saved || (web.clobbered & Target::mask(web.regClass, i)))) continue;
+        if (pass == 1 && saved != (web.calls > 1)) continue;
+        if (web.color == -1) web.color = i;
+        if (partner(i)) {
+          web.color = i;
+          break;
+        }
+      }
+    }
+
+    // a temporary that still doesn't fit falls back to the scratch registers
+    if (web.color == -1 && !temps.test(web.name)) spills.push_back(web.name);
+  }
+  return spills.empty();
+}
+
+// Move the spilled variables to memory. Every use reads a fresh temporary
+// loaded right before the instruction, and every def writes one that is
+// stored right after it, so what is left to color only lives across a single
+// instruction.
+void Global::insertSpillCode(const std::vector<Sym> &spills) {
+  if (spills.empty()) return;
+  for (Sym variable : spills) spilled.insert(variable);
+
+  for (Block &block : func->blocks) {
+    std::vector<IRInstruction> code;
+    code.reserve(block.ins.size());
+    Sym carry = NO_SYM; // label of a def that went away
+    for (size_t k = 0; k < block.ins.size(); ++k) {
+      IRInstruction ins = block.ins[k];
+      if (carry != NO_SYM) {
+        ins.label = carry;
+        carry = NO_SYM;
+      }
+      Sym label = ins.label;
+      size_t first = code.size();
+
+      SmallVector<Sym *, 3> used = ins.UseOperands();
+      for (unsigned i = 0; i < used.size(); ++i) {
+        Sym variable = *used[i];
+        if (!func->isVar(variable) || !spilled.test(variable)) continue;
+        Sym temp = func->symbols.temp(func->symbols.kind(variable));
+        temps.insert(temp);
+        // a constant is loaded again rather than from memory
+        auto constant = constants.find(variable);
+        code.push_back(IRInstruction(OP::assign, temp, constant != constants.end() ? constant->second : variable, NO_SYM));
+        // the same variable may be read twice
+        for (unsigned j = i; j < used.size(); ++j) {
+          if (*used[j] == variable) *used[j] = temp;
         }
       }
 
-      // assign color
-      web->color = i;
-      std::cout << " ASSIGN web " << web->name << " color " << i << std::endl;
-      break;
+      // the label moves up to the first reload
+      if (code.size() != first) {
+        ins.label = NO_SYM;
+        code[first].label = label;
+      }
 
-cont:;
+      Sym *def = ins.DefOperand();
+      if (def != nullptr && func->isVar(*def) && spilled.test(*def) && constants.count(*def)) {
+        // nothing to store, every use loads the constant again. the label
+        // goes to the next instruction, if there is one.
+        if (k + 1 < block.ins.size()) {
+          carry = label;
+        } else {
+          *def = func->symbols.temp(func->symbols.kind(*def));
+          temps.insert(*def);
+          code.push_back(ins);
+        }
+      } else if (def != nullptr && func->isVar(*def) && spilled.test(*def)) {
+        Sym variable = *def;
+        Sym temp = func->symbols.temp(func->symbols.kind(variable));
+        temps.insert(temp);
+        *def = temp;
+        code.push_back(ins);
+        code.push_back(IRInstruction(OP::assign, variable, temp, NO_SYM));
+      } else {
+        code.push_back(ins);
+      }
     }
+    block.ins = std::move(code);
   }
 }
 
 void Global::process(Program *program, Function *cfg) {
     this->program = program;
     this->func = cfg;
+    spilled.clear();
+    temps.clear();
+
+    dom.compute(func);
+    frequency.compute(func, dom);
 
-    // perform the full CFG liveness analysis across the basic blocks
+    // give independent uses of the same name their own variables, then
+    // fold the constants and the copies between them
     performLivenessAnalysis();
+    incoming.clear();
+    outgoing.clear();
+    splitWebs();
+    performLivenessAnalysis();
+    constants = foldConstants(func, liveness);
+    coalesce();
+
+    performLivenessAnalysis();
+    std::vector<bool> keep = registerParams(func, liveness);
+    for (size_t i = 0; i < keep.size(); ++i) {
+      if (keep[i]) incoming[func->intparams[i]] = "$a" + std::to_string(i);
+    }
+    passInPlace();
+
+    std::vector<Sym> spills;
+    do {
+      // rewrite the code for anything that didn't get a register last time
+      insertSpillCode(spills);
+      spills.clear();
 
-    // build live ranges and the webs
-    buildWebs();
+      // perform the full CFG liveness analysis across the basic blocks
+      performLivenessAnalysis();
 
-    // build an interference graph
-    buildInterferenceGraph();
+      // build live ranges and the webs
+      buildWebs();
 
-    // perform graph coloring using Briggs’ optimistic coloring algorithm
-    color();
+      // build an interference graph
+      buildInterferenceGraph();
+
+      // perform graph coloring using Briggs' optimistic coloring algorithm
+    } while (!color(spills));
 }
 
 void Global::enterFunction() {
   emit("# enter " + func->name);
-  for (auto &it : webs) {
-    Web *web = it.second;
+  for (auto &it : incoming) {
+    emit("# variable " + func->symbols.name(it.first) + " stays in " + it.second);
+  }
+  for (auto &it : outgoing) {
+    emit("# variable " + func->symbols.name(it.first) + " goes straight to " + it.second);
+  }
+  for (Web *web : webs) {
+    if (web == nullptr) continue;
+    const std::string &name = func->symbols.name(web->name);
     if (web->color != -1)
-      emit("# variable " + web->name + " assigned register " + std::to_string(web->color));
+      emit("# variable " + name + " assigned register " + web->reg());
     else
-      emit("# variable " + web->name + " is spilled!");
+      emit("# variable " + name + " is spilled!");
   }
+  spilled.for_each([&](Sym variable) {
+    if (constants.count(variable))
+      emit("# variable " + func->symbols.name(variable) + " is rematerialized");
+    else
+      emit("# variable " + func->symbols.name(variable) + " is spilled!");
+  });
 }
 
 void Global::spill(Block *block, IRInstruction *ins) {
   emit("# spilling for jal");
+  uint64_t clobbered = clobbers(func, *ins);
   Naive n;
   n.process(program, func);
-  for (auto &it : webs) {
-    Web *web = it.second;
-    if (web->color != -1 && web->ins.count(ins))
-      n.store("$s" + std::to_string(web->color), web->name);
+  for (Web *web : webs) {
+    if (web != nullptr && web->color != -1 && (clobbered & web->mask()) && web->name != ins->Def() && web->ins.count(ins))
+      n.store(web->reg(), web->name);
   }
 }
 
 void Global::unspill(Block *block, IRInstruction *ins) {
   emit("# unspilling");
+  uint64_t clobbered = clobbers(func, *ins);
   Naive n;
   n.process(program, func);
-  for (auto &it : webs) {
-    Web *web = it.second;
-    if (web->color != -1 && web->ins.count(ins))
-      n.reg(web->name, "$s" + std::to_string(web->color));
+  for (Web *web : webs) {
+    if (web != nullptr && web->color != -1 && (clobbered & web->mask()) && web->name != ins->Def() && web->ins.count(ins))
+      n.reg(web->name, web->reg());
   }
 }
 
-int Global::numVariables() {
-    return func->intlist.size() + func->floatlist.size();
+bool Global::inMemory(Sym variable) {
+  if (incoming.count(variable) || outgoing.count(variable)) return false;
+  if (spilled.test(variable)) return constants.count(variable) == 0; // constants are loaded with li
+  Web *web = webs[variable];
+  if (web == nullptr || web->color == -1) return true;
+  return web->clobbered & web->mask(); // saved around a call
 }
 
-std::string Global::reg(const std::string &variable, const std::string &suggestion) {
-  if (program->IsGlobal(variable)) {
+std::vector<std::string> Global::savedRegisters() {
+  uint64_t used = 0;
+  for (Web &web : nodes) {
+    if (web.color != -1 && web.calleeSaved()) used |= web.mask();
+  }
+  std::vector<std::string> saved;
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int i = 0; i < target.count(c); ++i) {
+      if (used & Target::mask(c, i)) saved.push_back(target.name(c, i));
+    }
+  }
+  return saved;
+}
+
+std::string Global::registerOf(Sym variable) const {
+  if (!func->isVar(variable)) return "";
+  auto it = incoming.find(variable);
+  if (it != incoming.end()) return it->second;
+  it = outgoing.find(variable);
+  if (it != outgoing.end()) return it->second;
+  Web *web = webs[variable];
+  return web != nullptr && web->color != -1 ? web->reg() : "";
+}
+
+std::string Global::destination(Sym variable, const std::string &fallback) {
+  std::string r = registerOf(variable);
+  return r.empty() ? fallback : r;
+}
+
+std::string Global::reg(Sym variable, const std::string &suggestion) {
+  const std::string &name = func->symbols.name(variable);
+  if (program->IsGlobal(func, variable)) {
     // global always gets loaded
-    emit("lw", suggestion, variable, "# load from " + variable);
+    emit("lw", suggestion, name, "# load from " + name);
     return suggestion;
   }
 
-  Web *web = webs.find(variable) != webs.end() ? webs[variable] : nullptr;
-  if (web != nullptr && web->color != -1) {
-    if (suggestion.find("$a") == 0 || suggestion.find("$v") == 0) {
+  std::string r = registerOf(variable);
+  if (!r.empty()) {
+    if (suggestion != r && (suggestion.find("$a") == 0 || suggestion.find("$v") == 0 || suggestion == "$f12")) {
       // if the target is a function parameter or return value, then we just do a move
-      emit("move", suggestion, "$s" + std::to_string(web->color), "# move of " + variable + " to fn arg/ret");
+      move(suggestion, r, "# move of " + name + " to fn arg/ret");
     }
 
     // there is a register assigned, so this is already valid and in a register
-    return "$s" + std::to_string(web->color);
+    return r;
   }
 
   Naive n;
@@ -330,22 +676,23 @@ std::string Global::reg(const std::string &variable, const std::string &suggesti
   return n.reg(variable, suggestion);
 }
 
-void Global::store(const std::string &reg, const std::string &variable) {
-  if (program->IsGlobal(variable)) {
+void Global::store(const std::string &reg, Sym variable) {
+  if (program->IsGlobal(func, variable)) {
     // global always gets stored
     Naive n;
     n.process(program, func);
     return n.store(reg, variable);
   }
 
-  Web *web = webs.find(variable) != webs.end() ? webs[variable] : nullptr;
-  if (web != nullptr && web->color != -1) {
+  std::string r = registerOf(variable);
+  if (!r.empty()) {
     // this is assigned a register!
+    if (reg == r) return; // already computed in place
     if (reg[0] != '$') {
       // not a register
-      emit("li", "$s" + std::to_string(web->color), reg, "# store to " + variable);
+      loadImmediate(r, reg, "# store to " + func->symbols.name(variable));
     } else {
-      emit("move", "$s" + std::to_string(web->color), reg, "# store to " + variable);
+      move(r, reg, "# store to " + func->symbols.name(variable));
     }
     return;
   }
@@ -355,10 +702,10 @@ void Global::store(const std::string &reg, const std::string &variable) {
   return n.store(reg, variable);
 }
 
-void Global::emitAndStore(const std::string &op, const std::string &dest, const std::string &a2, const std::string &a3) {
-  Web *web = webs.find(dest) != webs.end() ? webs[dest] : nullptr;
-  if (web != nullptr && web->color != -1) {
-    emit(op, "$s" + std::to_string(web->color), a2, a3);
+void Global::emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) {
+  std::string r = registerOf(dest);
+  if (!r.empty()) {
+    emit(op, r, a2, a3);
     return;
   }
 
@@ -366,4 +713,3 @@ void Global::emitAndStore(const std::string &op, const std::string &dest, const
   n.process(program, func);
   return n.emitAndStore(op, dest, a2, a3);
 }
-
@@ -1,8 +1,7 @@
 #include "IR.h"
-#include <sstream>
 #include <iostream>
 
-static const char *optable[] = {
+static constexpr std::string_view optable[] = {
   "assign",
   "add",
   "sub",
@@ -21,63 +20,238 @@ static const char *optable[] = {
   "call",
   "callr",
   "array_store",
-  "array_load"
+  "array_load",
+  "address",
+  "load",
+  "store",
+  "advance"
 };
 
+static constexpr unsigned int NUM_OPS = sizeof(optable)/sizeof(*optable);
+
 const char *op_to_str(OP op) {
-  return optable[static_cast<int>(op)];
+  return optable[static_cast<int>(op)].data();
 }
 
-OP str_to_op(const std::string &op) {
-  for (unsigned int i = 0; i < sizeof(optable)/sizeof(*optable); ++i) {
-    if (op == optable[i]) {
-      return static_cast<OP>(i);
+// Opcodes are looked up through a perfect hash: the seed is searched for at
+// compile time so that every name in optable lands in its own slot, so a
+// lookup is one hash and one compare.
+static constexpr unsigned int OP_SLOTS = 64;
+
+static constexpr unsigned int op_hash(std::string_view name, unsigned int seed) {
+  unsigned int h = seed;
+  for (char c : name) {
+    h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+  }
+  return (h ^ (h >> 16)) % OP_SLOTS;
+}
+
+static constexpr unsigned int find_op_seed() {
+  for (unsigned int seed = 1; seed < 10000; ++seed) {
+    bool used[OP_SLOTS] = { };
+    bool collision = false;
+    for (unsigned int i = 0; i < NUM_OPS && !collision; ++i) {
+      unsigned int slot = op_hash(optable[i], seed);
+      collision = used[slot];
+      used[slot] = true;
+    }
+    if (!collision) {
+      return seed;
     }
   }
+  return 0;
+}
+
+static constexpr unsigned int OP_SEED = find_op_seed();
+static_assert(OP_SEED != 0, "no perfect hash seed for the opcode table");
+
+struct OpSlots {
+  signed char op[OP_SLOTS];
+};
+
+static constexpr OpSlots build_op_slots() {
+  OpSlots slots = { };
+  for (unsigned int i = 0; i < OP_SLOTS; ++i) {
+    slots.op[i] = -1;
+  }
+  for (unsigned int i = 0; i < NUM_OPS; ++i) {
+    slots.op[op_hash(optable[i], OP_SEED)] = static_cast<signed char>(i);
+  }
+  return slots;
+}
+
+static constexpr OpSlots op_slots = build_op_slots();
+
+bool str_to_op(std::string_view name, OP &op) {
+  int idx = op_slots.op[op_hash(name, OP_SEED)];
+  if (idx < 0 || optable[idx] != name) {
+    return false;
+  }
+  op = static_cast<OP>(idx);
+  return true;
+}
+
+static inline bool separator(char c) {
+  return c == ',' || c == ' ' || c == '\t' || c == '\r';
+}
 
-  std::cerr << "unrecognized op: " << op << std::endl;
-  throw std::invalid_argument(op);
+std::string_view strip(std::string_view str) {
+  size_t begin = 0, end = str.size();
+  while (begin < end && separator(str[begin])) ++begin;
+  while (end > begin && separator(str[end - 1])) --end;
+  return str.substr(begin, end - begin);
 }
 
-static inline void strip(std::string &str) {
-  while (str.length() > 0 && (str[str.length() - 1] == ',' || str[str.length() - 1] == ' '
-        || str[str.length() - 1] == '\t')) {
-    str.erase(str.length() - 1);
+int Names::intern(std::string_view name) {
+  auto it = index.find(name);
+  if (it != index.end()) {
+    return it->second;
   }
-  while (str.length() > 0 && (str[0] == ',' || str[0] == ' ' || str[0] == '\t')) {
-    str.erase(0, 1);
+  int id = strings.size();
+  index.emplace(strings.emplace_back(name), id);
+  return id;
+}
+
+int Names::find(std::string_view name) const {
+  auto it = index.find(name);
+  return it == index.end() ? -1 : it->second;
+}
+
+Sym SymbolTable::intern(std::string_view name, SymKind kind) {
+  auto it = index.find(name);
+  if (it != index.end()) {
+    return it->second;
+  }
+  Sym sym = symbols.size();
+  int id = names->intern(name);
+  int slot = -1;
+  if (kind == SymKind::local_int || kind == SymKind::local_float) {
+    slot = variables.size();
+    variables.push_back(sym);
   }
+  symbols.push_back(Symbol { id, kind, slot });
+  index.emplace(names->str(id), sym);
+  return sym;
 }
 
-IRInstruction parseAsm(const std::string &line) {
-  std::stringstream ss(line);
-  std::string op1,op2,op3,op4;
-  std::getline(ss, op1, ',');
-  std::getline(ss, op2, ',');
-  std::getline(ss, op3, ',');
-  std::getline(ss, op4, ',');
-  strip(op1);
-  strip(op2);
-  strip(op3);
-  strip(op4);
-  std::cout << line << std::endl;
-  std::cout <<"." << op1 << ". " << op2 << " " <<op3 << " " << op4<<std::endl;
-  OP op = str_to_op(op1);
-  return IRInstruction(op, op2, op3, op4);
+Sym SymbolTable::temp(SymKind kind, std::string_view hint) {
+  // '$' names are never treated as globals, and no IR name has a '.'
+  std::string name(hint);
+  if (name.empty() || name[0] != '$') name.insert(0, "$");
+  name += "." + std::to_string(symbols.size());
+  return intern(name, kind);
 }
 
-std::ostream& operator<<(std::ostream& os, const IRInstruction &irins) {
-  os << op_to_str(irins.op) << " " << irins.arg1 << " " << irins.arg2 << " " << irins.arg3;
+Sym SymbolTable::find(std::string_view name) const {
+  auto it = index.find(name);
+  return it == index.end() ? NO_SYM : it->second;
+}
+
+// What an operand is, judging by its spelling alone. Declared variables are
+// already interned by the time the instructions are read.
+static SymKind classify(std::string_view operand) {
+  if (operand.empty()) {
+    return SymKind::global;
+  }
+  char c = operand[0];
+  if (isdigit(c) || c == '-' || c == '.') {
+    return operand.find('.') != std::string_view::npos ? SymKind::imm_float : SymKind::imm_int;
+  }
+  return SymKind::global;
+}
+
+static Sym operand(SymbolTable &symbols, std::string_view field, SymKind kind) {
+  return field.empty() ? NO_SYM : symbols.intern(field, kind);
+}
+
+bool parseAsm(std::string_view line, SymbolTable &symbols, IRInstruction &ins) {
+  // split into at most four comma separated fields, anything after is ignored
+  // except by calls
+  std::string_view fields[4];
+  for (std::string_view &field : fields) {
+    size_t comma = line.find(',');
+    field = strip(line.substr(0, comma));
+    line = comma == std::string_view::npos ? std::string_view() : line.substr(comma + 1);
+  }
+
+  OP op;
+  if (!str_to_op(fields[0], op)) {
+    std::cerr << "unrecognized op: " << fields[0] << std::endl;
+    return false;
+  }
+
+  // labels and function names are told apart by where they appear
+  SymKind kinds[3] = { classify(fields[1]), classify(fields[2]), classify(fields[3]) };
+  switch (op) {
+    case OP::_goto:
+      kinds[0] = SymKind::label;
+      break;
+    case OP::breq:
+    case OP::brneq:
+    case OP::brlt:
+    case OP::brgt:
+    case OP::brgeq:
+    case OP::brleq:
+      kinds[2] = SymKind::label;
+      break;
+    case OP::call:
+      kinds[0] = SymKind::function;
+      break;
+    case OP::callr:
+      kinds[1] = SymKind::function;
+      break;
+    default:
+      break;
+  }
+
+  ins = IRInstruction(op, operand(symbols, fields[1], kinds[0]), operand(symbols, fields[2], kinds[1]),
+      operand(symbols, fields[3], kinds[2]));
+
+  // calls take any number of arguments, the rest of the line holds the ones
+  // past the first fields
+  if (op == OP::call || op == OP::callr) {
+    while (!line.empty()) {
+      size_t comma = line.find(',');
+      std::string_view field = strip(line.substr(0, comma));
+      line = comma == std::string_view::npos ? std::string_view() : line.substr(comma + 1);
+      if (!field.empty()) ins.more.push_back(symbols.intern(field, classify(field)));
+    }
+  }
+  return true;
+}
+
+std::ostream& print(std::ostream& os, const IRInstruction &irins, const SymbolTable &symbols) {
+  os << op_to_str(irins.op);
+  for (Sym arg : { irins.arg1, irins.arg2, irins.arg3 }) {
+    os << " " << (arg == NO_SYM ? "" : symbols.name(arg));
+  }
+  for (Sym arg : irins.more) {
+    os << " " << symbols.name(arg);
+  }
   return os;
 }
 
 bool IRInstruction::Label() const {
-  return !label.empty();
+  return label != NO_SYM;
 }
 
-const std::string *IRInstruction::Target() const {
-  std::string targetLabel;
+Sym IRInstruction::Target() const {
+  switch (op) {
+    case OP::_goto:
+      return arg1;
+    case OP::breq:
+    case OP::brneq:
+    case OP::brlt:
+    case OP::brgt:
+    case OP::brgeq:
+    case OP::brleq:
+      return arg3;
+    default:
+      return NO_SYM;
+  }
+}
 
+Sym *IRInstruction::TargetOperand() {
   switch (op) {
     case OP::_goto:
       return &arg1;
@@ -104,17 +278,121 @@ bool IRInstruction::Terminal() const
     case OP::brleq:
     case OP::_return:
     case OP::_goto:
-    case OP::call:
-    case OP::callr:
       return true;
     default:
       return false;
   }
 }
 
-void IRInstruction::printIRInstruction() const{
+Sym *IRInstruction::DefOperand() {
+  switch (op) {
+    case OP::assign:
+    case OP::callr:
+    case OP::array_load:
+    case OP::address:
+    case OP::load:
+    case OP::advance:
+      return &arg1;
+    case OP::add:
+    case OP::sub:
+    case OP::mult:
+    case OP::div:
+    case OP::_and:
+    case OP::_or:
+      return &arg3;
+    default:
+      return nullptr;
+  }
+}
+
+SmallVector<Sym *, 3> IRInstruction::UseOperands() {
+  SmallVector<Sym *, 3> uses;
+  auto use = [&](Sym &s) {
+    if (s != NO_SYM) uses.push_back(&s);
+  };
+
+  switch (op) {
+    case OP::assign: // assign, x, y  or the array form assign, X, size, value
+    case OP::array_store: // array_store, X, index, value
+      use(arg2);
+      use(arg3);
+      break;
+    case OP::add:
+    case OP::sub:
+    case OP::mult:
+    case OP::div:
+    case OP::_and:
+    case OP::_or:
+    case OP::breq:
+    case OP::brneq:
+    case OP::brlt:
+    case OP::brgt:
+    case OP::brgeq:
+    case OP::brleq:
+      use(arg1);
+      use(arg2);
+      break;
+    case OP::_return:
+      use(arg1);
+      break;
+    case OP::call: // call, fn, a, b, ...
+      use(arg2);
+      use(arg3);
+      for (Sym &s : more) use(s);
+      break;
+    case OP::callr: // callr, x, fn, a, ...
+      use(arg3);
+      for (Sym &s : more) use(s);
+      break;
+    case OP::array_load: // array_load, x, X, index
+    case OP::address: // address, p, X, index
+      use(arg3);
+      break;
+    case OP::load: // load, x, p
+      use(arg2);
+      break;
+    case OP::store: // store, p, x
+      use(arg1);
+      use(arg2);
+      break;
+    case OP::advance: // advance, q, p, n
+      use(arg2);
+      break;
+    case OP::_goto:
+      break;
+  }
+  return uses;
+}
+
+Sym IRInstruction::Def() const {
+  const Sym *def = const_cast<IRInstruction *>(this)->DefOperand();
+  return def ? *def : NO_SYM;
+}
+
+SmallVector<Sym, 3> IRInstruction::Uses() const {
+  SmallVector<Sym, 3> uses;
+  for (Sym *s : const_cast<IRInstruction *>(this)->UseOperands()) uses.push_back(*s);
+  return uses;
+}
+
+int IRInstruction::NumArgs() const {
+  if (op == OP::call) return (arg2 != NO_SYM) + (arg3 != NO_SYM) + more.size();
+  if (op == OP::callr) return (arg3 != NO_SYM) + more.size();
+  return 0;
+}
+
+Sym IRInstruction::Arg(int i) const {
+  if (op == OP::call) {
+    if (i == 0) return arg2;
+    if (i == 1) return arg3;
+    return more[i - 2];
+  }
+  return i == 0 ? arg3 : more[i - 1];
+}
+
+void IRInstruction::printIRInstruction(const SymbolTable &symbols) const{
   std::cout << "OP   : " << op_to_str(op) << std::endl;
-  std::cout << "arg1 : " << arg1 << std::endl;
-  std::cout << "arg2 : " << arg2 << std::endl;
-  std::cout << "arg3 : " << arg3 << std::endl;
+  std::cout << "arg1 : " << (arg1 == NO_SYM ? "" : symbols.name(arg1)) << std::endl;
+  std::cout << "arg2 : " << (arg2 == NO_SYM ? "" : symbols.name(arg2)) << std::endl;
+  std::cout << "arg3 : " << (arg3 == NO_SYM ? "" : symbols.name(arg3)) << std::endl;
 }
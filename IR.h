@@ -1,5 +1,11 @@
+#pragma once
 #include <string>
-#include <set>
+#include <string_view>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include "BitSet.h"
+#include "SmallVector.h"
 enum class OP {
   assign,
   add,
@@ -20,33 +26,129 @@ enum class OP {
   callr,
   array_store,
   array_load,
+  // Made by the compiler, never in the IR it reads: walking an array with a
+  // pointer instead of an index (see Induction.cpp)
+  address, // address, p, X, index  p = &X[index]
+  load,    // load, x, p            x = *p
+  store,   // store, p, x           *p = x
+  advance, // advance, q, p, n      q = p + n bytes
 };
 
 
 
 const char *op_to_str(OP op);
+// Look up an opcode by name; returns false if the name is not an opcode
+bool str_to_op(std::string_view name, OP &op);
+
+// Every operand is interned into a dense per-function symbol id when the IR
+// is read, so the passes compare and index integers instead of strings.
+typedef int Sym;
+#define NO_SYM (-1)
+
+enum class SymKind : unsigned char {
+  local_int,   // in the function's int-list
+  local_float, // in the function's float-list
+  global,      // a variable name the function doesn't declare
+  imm_int,
+  imm_float,
+  label,
+  array,       // declared as X[length] in a list, the data is in .data
+  function,
+};
+
+// Program wide string interner; each distinct name is stored once and gets
+// a dense id, so a name means the same thing in every function.
+class Names {
+ public:
+  int intern(std::string_view name);
+  // the id of name, -1 if it hasn't been interned
+  int find(std::string_view name) const;
+  const std::string &str(int id) const { return strings[id]; }
+  size_t size() const { return strings.size(); }
+
+ private:
+  std::deque<std::string> strings; // a deque so the index keys stay valid
+  std::unordered_map<std::string_view, int> index;
+};
+
+class SymbolTable {
+ public:
+  Names *names = nullptr;
+
+  // Return the id for name, adding it with the given kind if it is new.
+  // Every variable also gets the next stack slot, so the declared variables
+  // (int-list, then float-list) take the first slots.
+  Sym intern(std::string_view name, SymKind kind);
+  Sym find(std::string_view name) const;
+  // Add a fresh variable of the given kind, for values made up by the
+  // allocators (spill temporaries, split up webs). The name is "$hint.N".
+  Sym temp(SymKind kind, std::string_view hint = "spill");
+
+  const std::string &name(Sym sym) const { return names->str(symbols[sym].name); }
+  // the program wide id of the symbol's name
+  int nameId(Sym sym) const { return symbols[sym].name; }
+  SymKind kind(Sym sym) const { return symbols[sym].kind; }
+  // The variable's number, -1 for anything else. Variables are numbered
+  // densely from 0, which also makes this their stack slot.
+  int slot(Sym sym) const { return symbols[sym].slot; }
+  Sym variable(int slot) const { return variables[slot]; }
+  size_t size() const { return symbols.size(); }
+  int numVariables() const { return variables.size(); }
+
+ private:
+  struct Symbol {
+    int name;
+    SymKind kind;
+    int slot;
+  };
+  std::vector<Symbol> symbols;
+  std::unordered_map<std::string_view, Sym> index; // keys point into names
+  std::vector<Sym> variables; // by slot
+};
 
 class IRInstruction {
  public:
    OP op;
-   std::string arg1, arg2, arg3;
-   std::string label;
+   Sym arg1 = NO_SYM, arg2 = NO_SYM, arg3 = NO_SYM;
+   Sym label = NO_SYM;
+   // call arguments that don't fit in arg2/arg3 (call) or arg3 (callr)
+   std::vector<Sym> more;
 
    IRInstruction() = default;
-   IRInstruction(OP _op, const std::string &_arg1, const std::string &_arg2,
-       const std::string &_arg3) : op(_op), arg1(_arg1), arg2(_arg2), arg3(_arg3) { }
+   IRInstruction(OP _op, Sym _arg1, Sym _arg2, Sym _arg3) : op(_op), arg1(_arg1), arg2(_arg2), arg3(_arg3) { }
 
    // Return true if this instruction has a label (is a jump target)
    bool Label() const;
    // Get the target label for this instruction, if it is a jump
-   const std::string *Target() const;
+   Sym Target() const;
+   // Same as Target, but pointing at the operand, nullptr if not a jump
+   Sym *TargetOperand();
+   // Whether this ends its block: a jump, branch or return. Calls don't,
+   // they come back to the next instruction.
    bool Terminal() const;
 
-   void printIRInstruction() const;
+   // The operand this instruction writes, or NO_SYM
+   Sym Def() const;
+   // The operands this instruction reads. These may be immediates or
+   // globals, callers keep the ones they track.
+   SmallVector<Sym, 3> Uses() const;
+   // Same as Def and Uses, but pointing at the operand fields so passes can
+   // rename them
+   Sym *DefOperand();
+   SmallVector<Sym *, 3> UseOperands();
+
+   // The arguments of a call or callr, in order
+   int NumArgs() const;
+   Sym Arg(int i) const;
 
-   std::set<std::string> defs, uses, liveout;
+   void printIRInstruction(const SymbolTable &symbols) const;
 };
 
-extern IRInstruction parseAsm(const std::string &line);
+// Parse one instruction line ("op, a1, a2, a3"), interning its operands.
+// Returns false if the line does not start with a known opcode.
+extern bool parseAsm(std::string_view line, SymbolTable &symbols, IRInstruction &ins);
+// Trim the separators (commas, blanks) from both ends of a field
+extern std::string_view strip(std::string_view str);
 
-std::ostream& operator<<(std::ostream& os, const IRInstruction &irins);
+// Print an instruction in IR syntax
+std::ostream& print(std::ostream& os, const IRInstruction &irins, const SymbolTable &symbols);
@@ -0,0 +1,184 @@
+#include "Induction.h"
+#include "Dataflow.h"
+#include "Dominators.h"
+#include "LoopInvariant.h"
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <set>
+
+static bool isBranch(OP op) {
+  return op == OP::breq || op == OP::brneq || op == OP::brlt || op == OP::brgt || op == OP::brgeq || op == OP::brleq;
+}
+
+// Walk the arrays the loop starting at block h indexes with its induction
+// variables with pointers instead. Returns false, and changes nothing, if
+// there are none.
+static bool reduceLoop(Program *program, Function *function, const Dominators &dom, const Liveness &liveness, int h) {
+  std::vector<Block> &blocks = function->blocks;
+  SymbolTable &symbols = function->symbols;
+  if (!canAddPreheader(function, dom, h)) return false;
+
+  std::vector<int> body;
+  for (const Block &b : blocks) {
+    if (dom.contains(h, b.index)) body.push_back(b.index);
+  }
+  std::vector<int> defs(symbols.size(), 0);
+  for (int b : body) {
+    for (const IRInstruction &ins : blocks[b].ins) {
+      Sym def = ins.Def();
+      if (def != NO_SYM) ++defs[def];
+    }
+  }
+  auto immediate = [&](Sym s) { return s != NO_SYM && symbols.kind(s) == SymKind::imm_int; };
+  auto local = [&](Sym s) { return function->isInt(s) && !program->IsGlobal(function, s); };
+
+  std::vector<IRInstruction> code; // for the preheader
+  for (int b : body) {
+    for (size_t k = 0; k < blocks[b].ins.size(); ++k) {
+      // i = i + c, i = c + i or i = i - c, and nothing else writes i. The
+      // pointers made here are new, and never count.
+      const IRInstruction increment = blocks[b].ins[k];
+      Sym i = increment.Def();
+      if ((increment.op != OP::add && increment.op != OP::sub) || !local(i) || i >= (Sym) defs.size() || defs[i] != 1) {
+        continue;
+      }
+      Sym step = NO_SYM;
+      if (increment.arg1 == i && immediate(increment.arg2)) {
+        step = increment.arg2;
+      } else if (increment.op == OP::add && increment.arg2 == i && immediate(increment.arg1)) {
+        step = increment.arg1;
+      } else {
+        continue;
+      }
+
+      // a pointer for each array i indexes, which the accesses go through
+      std::map<Sym, Sym> pointers;
+      std::vector<Sym> arrays; // in the order they are first accessed
+      for (int a : body) {
+        for (IRInstruction &ins : blocks[a].ins) {
+          Sym array;
+          if (ins.op == OP::array_load && ins.arg3 == i) {
+            array = ins.arg2;
+          } else if (ins.op == OP::array_store && ins.arg2 == i) {
+            array = ins.arg1;
+          } else {
+            continue;
+          }
+          if (function->isVar(array)) continue;
+          auto [it, added] = pointers.emplace(array, NO_SYM);
+          if (added) {
+            it->second = symbols.temp(SymKind::local_int, "ptr");
+            arrays.push_back(array);
+          }
+          Sym label = ins.label;
+          if (ins.op == OP::array_load) {
+            ins = IRInstruction(OP::load, ins.arg1, it->second, NO_SYM);
+          } else {
+            ins = IRInstruction(OP::store, it->second, ins.arg3, NO_SYM);
+          }
+          ins.label = label;
+        }
+      }
+      if (arrays.empty()) continue;
+
+      // each pointer starts at &X[i] and moves 4 * c along with i, with an
+      // advance, which can't trap on overflow the way the add of i can
+      int bytes = 4 * atoi(symbols.name(step).c_str());
+      Sym scaled = symbols.intern(std::to_string(increment.op == OP::sub ? -bytes : bytes), SymKind::imm_int);
+      std::vector<IRInstruction> moves;
+      for (Sym array : arrays) {
+        Sym p = pointers[array];
+        code.emplace_back(OP::address, p, array, i);
+        moves.emplace_back(OP::advance, p, p, scaled);
+      }
+
+      // If all that is left of i is one test against a bound, and nothing
+      // reads it after the loop, the test can compare the first pointer
+      // with &X[bound] instead and i can stop counting. X + 4 * i only keeps
+      // the order of i while it doesn't wrap, so the bound, and the value i
+      // has on every way into the loop, must be immediates inside X (or one
+      // past its end).
+      IRInstruction *test = nullptr;
+      bool other = false;
+      for (int a : body) {
+        for (IRInstruction &ins : blocks[a].ins) {
+          SmallVector<Sym, 3> uses = ins.Uses();
+          if (&ins == &blocks[b].ins[k] || std::find(uses.begin(), uses.end(), i) == uses.end()) continue;
+          if (isBranch(ins.op) && test == nullptr && (ins.arg1 == i) != (ins.arg2 == i)) {
+            test = &ins;
+          } else {
+            other = true;
+          }
+        }
+      }
+      bool live = false;
+      for (int a : body) {
+        for (int s : blocks[a].next) {
+          live |= !dom.contains(h, s) && liveness.liveIn(s).test(symbols.slot(i));
+        }
+      }
+      Sym bound = test == nullptr ? NO_SYM : test->arg1 == i ? test->arg2 : test->arg1;
+      int length = 0;
+      for (auto [array, words] : function->arrays) {
+        if (array == arrays[0]) length = words;
+      }
+      auto inside = [&](Sym s) {
+        int value = immediate(s) ? atoi(symbols.name(s).c_str()) : -1;
+        return value >= 0 && value <= length;
+      };
+      bool entered = true;
+      for (int p : blocks[h].prev) {
+        if (dom.contains(h, p)) continue;
+        auto set = std::find_if(blocks[p].ins.rbegin(), blocks[p].ins.rend(), [&](const IRInstruction &ins) { return ins.Def() == i; });
+        entered &= set != blocks[p].ins.rend() && set->op == OP::assign && inside(set->arg2);
+      }
+
+      std::vector<IRInstruction> &ins = blocks[b].ins;
+      if (test != nullptr && !other && !live && inside(bound) && entered) {
+        Sym end = symbols.temp(SymKind::local_int, "end");
+        code.emplace_back(OP::address, end, arrays[0], bound);
+        bool first = test->arg1 == i;
+        (first ? test->arg1 : test->arg2) = pointers[arrays[0]];
+        (first ? test->arg2 : test->arg1) = end;
+        moves[0].label = increment.label;
+        ins.erase(ins.begin() + k);
+        ins.insert(ins.begin() + k, moves.begin(), moves.end());
+        k += moves.size() - 1;
+      } else {
+        ins.insert(ins.begin() + k + 1, moves.begin(), moves.end());
+        k += moves.size();
+      }
+    }
+  }
+  if (code.empty()) return false;
+
+  addPreheader(program, function, dom, h, code);
+  return true;
+}
+
+// One loop at a time, innermost first, like hoistInvariants
+void reduceInductions(Program *program, Function *function) {
+  std::set<Sym> done; // headers by label
+  for (bool again = true; again;) {
+    again = false;
+    Dominators dom;
+    dom.compute(function);
+    std::vector<int> headers;
+    for (const Block &b : function->blocks) {
+      if (dom.header(b.index) == b.index) headers.push_back(b.index);
+    }
+    if (headers.empty()) return;
+    std::stable_sort(headers.begin(), headers.end(), [&](int a, int b) { return dom.depth(a) > dom.depth(b); });
+
+    Liveness liveness;
+    liveness.compute(function);
+    for (int h : headers) {
+      if (!done.insert(function->blocks[h].label).second) continue;
+      if (reduceLoop(program, function, dom, liveness, h)) {
+        again = true;
+        break;
+      }
+    }
+  }
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "CFG.h"
+
+// Strength reduction of array accesses in loops. A basic induction variable
+// is one whose only write in the loop adds a constant to it (add, i, 1, i).
+// Each array the loop indexes with one gets a pointer, set to &X[i] in a
+// preheader and moved along with i, and the accesses go through it (load and
+// store) instead of working out X + 4 * i every time. When i is then only
+// left counting the loop, the exit test compares the pointer against the
+// address of the bound instead and i goes away (linear function test
+// replacement). Runs after hoistInvariants.
+extern void reduceInductions(Program *program, Function *function);
@@ -0,0 +1,34 @@
+#include "Interference.h"
+#include <utility>
+
+void InterferenceGraph::reset(int nodes) {
+  adj.assign(nodes, std::vector<int>());
+  hashed = bit(nodes, 0) > MAX_MATRIX_BITS;
+  matrix.assign(hashed ? 0 : (bit(nodes, 0) + 63) / 64, 0);
+  edges.clear();
+}
+
+void InterferenceGraph::addEdge(int a, int b) {
+  if (a == b) return;
+  if (a < b) std::swap(a, b);
+
+  uint64_t i = bit(a, b);
+  if (hashed) {
+    if (!edges.insert(i).second) return;
+  } else {
+    uint64_t mask = uint64_t(1) << (i % 64);
+    if (matrix[i / 64] & mask) return;
+    matrix[i / 64] |= mask;
+  }
+
+  adj[a].push_back(b);
+  adj[b].push_back(a);
+}
+
+bool InterferenceGraph::interferes(int a, int b) const {
+  if (a == b) return false;
+  if (a < b) std::swap(a, b);
+  uint64_t i = bit(a, b);
+  if (hashed) return edges.count(i) != 0;
+  return (matrix[i / 64] >> (i % 64)) & 1;
+}
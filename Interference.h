@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+// Undirected interference graph over dense node ids. Edges are kept twice:
+// in a triangular bit matrix for constant time queries, and in per-node
+// adjacency lists for walking the neighbors. Graphs too big for the matrix
+// (it grows with the square of the node count) keep a hash set of edges
+// instead.
+class InterferenceGraph {
+ public:
+  void reset(int nodes);
+  int size() const { return adj.size(); }
+
+  // Adds the edge a - b. Self edges and duplicates are ignored.
+  void addEdge(int a, int b);
+  bool interferes(int a, int b) const;
+
+  const std::vector<int> &neighbors(int node) const { return adj[node]; }
+  int degree(int node) const { return adj[node].size(); }
+
+ private:
+  static inline uint64_t bit(int a, int b) {
+    // lower triangle, a > b
+    return uint64_t(a) * (a - 1) / 2 + b;
+  }
+
+  static const uint64_t MAX_MATRIX_BITS = uint64_t(1) << 26; // 8MB
+
+  bool hashed = false;
+  std::vector<uint64_t> matrix;
+  std::unordered_set<uint64_t> edges; // bit indices, when hashed
+  std::vector<std::vector<int>> adj;
+};
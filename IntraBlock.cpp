@@ -1,231 +1,258 @@
+#include <algorithm>
+#include <limits>
+
 #include "CFG.h"
 #include "Strategy.h"
 #include "CodeGen.h"
-#include <iostream>
 
 void IntraBlock::performLivenessAnalysis() {
-    Block *currBlock = this->func->start; // start at first block in function
-    IRInstruction * currIns;
-    while(currBlock != nullptr){
-        for(int i = 0; i < currBlock->ins.size(); i++){
-            currIns = &(currBlock->ins[i]);
-            switch (currIns->op){
-                case OP::assign:
-                    // Variable assignment
-                    if(currIns->arg3.empty()){
-                        if(func->isVar(currIns->arg1)){
-                            currBlock->defs[i] = currIns->arg1;
-                        }
-                        if(func->isVar(currIns->arg2)){
-                            currBlock->uses.insert(std::make_pair(i, currIns->arg2));
-                        } 
-                    }
-                        // Array assignment
-                    else {
-                        if(func->isVar(currIns->arg1)){
-                            currBlock->defs[i] = currIns->arg1;
-                        }
-                        if(func->isVar(currIns->arg2)){
-                            currBlock->uses.insert(std::make_pair(i, currIns->arg2));
-                        }
-                        if(func->isVar(currIns->arg3)){
-                            currBlock->uses.insert(std::make_pair(i, currIns->arg3));
-                        }
-                    }
-                    break;
-                case OP::add:
-                case OP::sub:
-                case OP::mult:
-                case OP::div:
-                case OP::_and:
-                case OP::_or:
-                    if(func->isVar(currIns->arg1)){
-                        currBlock->uses.insert(std::make_pair(i, currIns->arg1));
-                    }
-                    if(func->isVar(currIns->arg2)){
-                        currBlock->uses.insert(std::make_pair(i, currIns->arg2));
-                    }
-                    if(func->isVar(currIns->arg3)){
-                        currBlock->defs[i] = currIns->arg3;
-                    }
-                case OP::_goto:
-                    // UNUSED, no def or use
-                    break;
-                case OP::breq:
-                case OP::brneq:
-                case OP::brlt:
-                case OP::brgt:
-                case OP::brgeq:
-                case OP::brleq:
-                    if(func->isVar(currIns->arg1)){
-                        currBlock->uses.insert(std::make_pair(i, currIns->arg1));
-                    }
-                    if(func->isVar(currIns->arg2)){
-                        currBlock->uses.insert(std::make_pair(i, currIns->arg2));
-                    } 
-                    break;
-                case OP::_return:
-                    if(func->isVar(currIns->arg1)){
-                        currBlock->uses.insert(std::make_pair(i, currIns->arg1));
-                    }
-                    break;
-                case OP::call:
-                    if(func->isVar(currIns->arg2)){
-                        currBlock->uses.insert(std::make_pair(i, currIns->arg2));
-                    }
-                    if(func->isVar(currIns->arg3)){
-                        currBlock->uses.insert(std::make_pair(i, currIns->arg3));
-                    }
-                    break;
-                case OP::callr:
-                    // TODO implement
-                    break;
-                case OP::array_store:
-                    // TODO implement
-                    break;
-                case OP::array_load:
-                    // TODO implement
-                    break;
-                default:
-                    // not def or use
-                    break;
-            }
-        }
-        currBlock = currBlock->after; // go to next block
-    }
-
-    bool changed = true;
-    while (changed) {
-      changed = false;
-
-      for (Block *block = func->start; block; block = block->after) {
-        std::set<std::string> liveout;
-
-        for (Block *succ : block->next) {
-          std::set<std::string> lo = succ->liveout;
-          // remove things we killed
-          for (std::string kill : succ->GetDefs()) {
-            lo.erase(kill);
-          }
-
-          // union with uses
-          for (std::string use : succ->GetUses()) {
-            lo.insert(use);
-          }
-
-          // union into running liveout
-          for (std::string l : lo) liveout.insert(l);
-        }
-        if (block->liveout != liveout) {
-          block->liveout = liveout; // apply
-          changed = true;
-        }
-      }
-    }
+    liveness.compute(func);
 }
 
 void IntraBlock::process(Program *program, Function *cfg) {
     this->program = program;
     this->func = cfg;
+    liveout = nullptr;
     //perform liveness analysis here
     performLivenessAnalysis();
+    foldConstants(func, liveness);
+    performLivenessAnalysis();
 
+    // the lowest free register is always taken first, so a block never
+    // goes past as many registers as it has variables, and the callee saved
+    // ones are only touched if some block has more than the caller saved
+    registers[0] = registers[1] = 0;
+    for (Block &block : func->blocks) {
+      BitSet used[2];
+      for (const IRInstruction &ins : block.ins) {
+        for (Sym variable : ins.Uses()) {
+          if (func->isVar(variable)) used[int(regClass(variable))].insert(func->symbols.slot(variable));
+        }
+        Sym def = ins.Def();
+        if (func->isVar(def)) used[int(regClass(def))].insert(func->symbols.slot(def));
+      }
+      for (RegClass c : { RegClass::integer, RegClass::floating }) {
+        registers[int(c)] = std::max(registers[int(c)], std::min<int>(used[int(c)].size(), target.count(c)));
+      }
+    }
 }
 
 void IntraBlock::enterBlock(Block *block) {
-  // load all variables that this block uses, based on number of usages...
-  std::map<std::string, int> uses; // variable -> usage count
+  // every variable starts out in memory
+  refs.clear();
+  where.clear();
+  dirty.clear();
+  for (RegClass c : { RegClass::integer, RegClass::floating }) holds[int(c)].assign(target.count(c), NO_SYM);
+  position = 0;
+  liveout = &liveness.liveOut(block->index);
 
-  for (auto &it : block->uses) {
-    int insidx = it.first;
-    const std::string &variable = it.second;
-    uses[variable]++;
+  // globals are shared with the functions it calls, so they stay in memory
+  for (int i = 0; i < (int) block->ins.size(); ++i) {
+    const IRInstruction &ins = block->ins[i];
+    for (Sym variable : ins.Uses()) {
+      if (func->isVar(variable) && !program->IsGlobal(func, variable)) refs[variable].push_back(Ref { i, true });
+    }
+    Sym def = ins.Def();
+    if (func->isVar(def) && !program->IsGlobal(func, def)) refs[def].push_back(Ref { i, false });
   }
+  emit("# start of block");
+}
 
-  std::multimap<int, std::string> rev;
-  for (auto &it : uses) {
-    rev.insert(std::make_pair(it.second, it.first));
-  }
+void IntraBlock::enterInstruction(Block *block, IRInstruction *ins) {
+  position = ins - block->ins.data();
+}
+
+void IntraBlock::exitBlock(Block *block) {
+  // what changed goes back to memory if the next blocks read it. This comes
+  // before the block's last instruction when that is a jump, branch or
+  // return, which can still read the registers but can't write them.
+  emit("# begin spilling");
 
-  assignments.clear();
-  int idx = 0;
   Naive n;
   n.process(program, func);
-  emit("# start of block - loading into registers");
-  for (auto it = rev.rbegin(); it != rev.rend() && idx < MAX_REGISTERS; ++it) {
-    emit("# variable " + it->second + " is assigned register $s" + std::to_string(idx));
-    assignments[it->second] = idx;
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int r = 0; r < target.count(c); ++r) {
+      Sym variable = holds[int(c)][r];
+      if (variable == NO_SYM || !dirty.test(variable) || !liveout->test(func->symbols.slot(variable))) continue;
+      n.store(target.name(c, r), variable);
+      dirty.erase(variable);
+    }
+  }
 
-    n.reg(it->second, "$s" + std::to_string(idx));
+  emit("# end of block");
+}
 
-    ++idx;
+// A call is just another instruction of the block. The values in registers
+// it overwrites that are read after it, and changed since they were loaded,
+// go to memory before the arguments are set up; they stay in their
+// registers until the jal, so an argument can still be moved from one.
+void IntraBlock::spill(Block *block, IRInstruction *ins) {
+  emit("# spilling for jal");
+  uint64_t clobbered = clobbers(func, *ins);
+  Naive n;
+  n.process(program, func);
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int r = 0; r < target.count(c); ++r) {
+      Sym variable = holds[int(c)][r];
+      if (variable == NO_SYM || !(clobbered & Target::mask(c, r)) || variable == ins->Def()) continue;
+      if (dirty.test(variable) && needed(variable, position + 1)) {
+        n.store(target.name(c, r), variable);
+        dirty.erase(variable);
+      }
+    }
   }
 }
 
-void IntraBlock::exitBlock(Block *block) {
-  // store variables in registers back to the stack
-  // note that we only have to store variables which got changed!
-  
-  std::set<std::string> defs = block->GetDefs();
+// after the jal the overwritten registers are free, and the values that
+// were in them are loaded again where they are next read
+void IntraBlock::unspill(Block *block, IRInstruction *ins) {
+  emit("# unspilling");
+  uint64_t clobbered = clobbers(func, *ins);
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int r = 0; r < target.count(c); ++r) {
+      Sym variable = holds[int(c)][r];
+      if (variable == NO_SYM || !(clobbered & Target::mask(c, r))) continue;
+      dirty.erase(variable);
+      where.erase(variable);
+      holds[int(c)][r] = NO_SYM;
+    }
+  }
+}
 
-  emit("# begin spilling");
+const IntraBlock::Ref *IntraBlock::next(Sym variable, int from) const {
+  auto it = refs.find(variable);
+  if (it == refs.end()) return nullptr;
+  auto ref = std::lower_bound(it->second.begin(), it->second.end(), from, [](const Ref &r, int p) {
+    return r.position < p;
+  });
+  return ref == it->second.end() ? nullptr : &*ref;
+}
 
-  Naive n;
-  n.process(program, func);
-  for (auto &it : assignments) {
-    const std::string &variable = it.first;
-    if (defs.count(variable) == 0) continue;
-    if (block->liveout.count(variable) == 0) continue;
-    int _register = it.second;
-    n.store("$s" + std::to_string(_register), variable); 
+bool IntraBlock::needed(Sym variable, int from) const {
+  const Ref *ref = next(variable, from);
+  if (ref != nullptr) return ref->read;
+  return liveout->test(func->symbols.slot(variable));
+}
+
+void IntraBlock::evict(RegClass c, int reg, int from) {
+  Sym variable = holds[int(c)][reg];
+  if (dirty.test(variable) && needed(variable, from)) {
+    Naive n;
+    n.process(program, func);
+    n.store(target.name(c, reg), variable);
   }
+  dirty.erase(variable);
+  where.erase(variable);
+  holds[int(c)][reg] = NO_SYM;
+}
 
-  emit("# end of block");
+// A free register if there is one. Otherwise the one whose value is read
+// again furthest from here, values that are dead or only written again
+// first, and among equals one that doesn't need storing. from is the first
+// instruction still to read the registers: the current one for its
+// operands, the next one for its result.
+int IntraBlock::allocate(Sym variable, int from) {
+  RegClass c = regClass(variable);
+  std::vector<Sym> &regs = holds[int(c)];
+  int pick = std::find(regs.begin(), regs.end(), NO_SYM) - regs.begin();
+  if (pick == (int) regs.size()) {
+    pick = -1;
+    int furthest = -1;
+    bool clean = false;
+    for (int r = 0; r < (int) regs.size(); ++r) {
+      const Ref *ref = next(regs[r], from);
+      int distance = ref == nullptr || !ref->read ? std::numeric_limits<int>::max() : ref->position;
+      if (distance < from || (ref != nullptr && ref->read && ref->position == position && from == position)) continue;
+      bool unchanged = !dirty.test(regs[r]) || !needed(regs[r], from);
+      if (distance > furthest || (distance == furthest && unchanged && !clean)) {
+        pick = r;
+        furthest = distance;
+        clean = unchanged;
+      }
+    }
+    if (pick == -1) return -1;
+    evict(c, pick, from);
+  }
+  regs[pick] = variable;
+  where[variable] = pick;
+  return pick;
+}
+
+std::vector<std::string> IntraBlock::savedRegisters() {
+  std::vector<std::string> saved;
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int i = 0; i < registers[int(c)]; ++i) {
+      if (target.calleeSaved(c, i)) saved.push_back(target.name(c, i));
+    }
+  }
+  return saved;
 }
 
-int IntraBlock::numVariables() {
-    return func->intlist.size() + func->floatlist.size();
+std::string IntraBlock::registerOf(Sym variable) const {
+  auto it = where.find(variable);
+  return it == where.end() ? "" : target.name(regClass(variable), it->second);
 }
 
-std::string IntraBlock::reg(const std::string &variable, const std::string &suggestion) {
-  if (assignments.find(variable) != assignments.end()) {
-    if (suggestion.find("$a") == 0 || suggestion.find("$v") == 0) {
+std::string IntraBlock::reg(Sym variable, const std::string &suggestion) {
+  bool fixed = suggestion.find("$a") == 0 || suggestion.find("$v") == 0 || suggestion == "$f12";
+  std::string r = registerOf(variable);
+  if (!r.empty()) {
+    if (fixed) {
       // if the target is a function parameter or return value, then we just do a move
-      emit("move", suggestion, "$s" + std::to_string(assignments[variable]), "# move of " + variable + " to fn arg/ret");
+      move(suggestion, r, "# move of " + func->symbols.name(variable) + " to fn arg/ret");
     }
 
     // there is a register assigned, so this is already valid and in a register
-    return "$s" + std::to_string(assignments[variable]);
+    return r;
   }
 
   Naive n;
   n.process(program, func);
-  return n.reg(variable, suggestion);
+  // an argument or return value that isn't in a register already goes
+  // straight to where it is passed
+  if (liveout == nullptr || fixed || refs.count(variable) == 0) return n.reg(variable, suggestion);
+  int allocated = allocate(variable, position);
+  if (allocated == -1) return n.reg(variable, suggestion);
+  return n.reg(variable, target.name(regClass(variable), allocated));
 }
 
-void IntraBlock::store(const std::string &reg, const std::string &variable) {
-  if (assignments.find(variable) != assignments.end()) {
-    if (reg[0] != '$') {
-      // not a register
-      emit("li", "$s" + std::to_string(assignments[variable]), reg);
-    } else {
-      emit("move", "$s" + std::to_string(assignments[variable]), reg);
-    }
-    return;
-  }
-
+void IntraBlock::store(const std::string &reg, Sym variable) {
   Naive n;
   n.process(program, func);
-  return n.store(reg, variable);
+  // parameters are stored before the first block
+  if (liveout == nullptr || refs.count(variable) == 0) {
+    if (where.count(variable)) evict(regClass(variable), where[variable], position + 1);
+    return n.store(reg, variable);
+  }
+
+  std::string r = registerOf(variable);
+  if (r.empty()) {
+    int allocated = allocate(variable, position + 1);
+    if (allocated == -1) return n.store(reg, variable);
+    r = target.name(regClass(variable), allocated);
+  }
+  if (reg[0] != '$') {
+    // not a register
+    loadImmediate(r, reg);
+  } else if (reg != r) {
+    move(r, reg);
+  }
+  dirty.insert(variable);
 }
 
-void IntraBlock::emitAndStore(const std::string &op, const std::string &dest, const std::string &a2, const std::string &a3) {
-  if (assignments.find(dest) != assignments.end()) {
-    // dest variable already has a register
-    emit(op, "$s" + std::to_string(assignments[dest]), a2, a3);
-  } else {
-    Naive n;
-    n.process(program, func);
-    return n.emitAndStore(op, dest, a2, a3);
+void IntraBlock::emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) {
+  std::string r = registerOf(dest);
+  if (r.empty() && refs.count(dest)) {
+    int allocated = allocate(dest, position + 1);
+    if (allocated != -1) r = target.name(regClass(dest), allocated);
+  }
+  if (!r.empty()) {
+    emit(op, r, a2, a3);
+    dirty.insert(dest);
+    return;
   }
+
+  Naive n;
+  n.process(program, func);
+  return n.emitAndStore(op, dest, a2, a3);
 }
@@ -0,0 +1,294 @@
+#include <algorithm>
+
+#include "CFG.h"
+#include "Strategy.h"
+#include "CodeGen.h"
+
+// Linear scan (Poletto & Sarkar). The instructions are numbered in layout
+// order, each variable gets one interval covering everywhere it is live, and
+// the intervals are handed registers in a single sweep by start point. When
+// every register is taken, the interval with the fewest uses per position
+// goes to memory, each use counting as often as its block is estimated to
+// run: that is the one ending furthest away, unless it is used much more
+// than the others (a loop counter that lives to the end). Int and
+// float intervals draw from separate register files, and only compete with
+// their own kind.
+//
+// Positions: instruction k reads at 2k and writes at 2k + 1, so a value that
+// dies at k can hand its register to the one k defines.
+
+void LinearScan::buildIntervals() {
+  intervals.clear();
+  interval.assign(func->symbols.size(), -1);
+
+  auto extend = [&](Sym variable, int position) {
+    if (program->IsGlobal(func, variable)) return; // globals always live in memory
+    if (incoming.count(variable)) return; // stays in its $a register
+    int &i = interval[variable];
+    if (i == -1) {
+      i = intervals.size();
+      RegClass c = func->isFloat(variable) ? RegClass::floating : RegClass::integer;
+      intervals.push_back(Interval { variable, c, position, position, -1, 0, 0, 0 });
+    }
+    intervals[i].start = std::min(intervals[i].start, position);
+    intervals[i].end = std::max(intervals[i].end, position);
+  };
+
+  int first = 0; // number of the block's first instruction
+  for (Block &block : func->blocks) {
+    liveness.liveIn(block.index).for_each([&](int slot) {
+      extend(func->symbols.variable(slot), 2 * first);
+    });
+    liveness.walk(block, [&](int idx, const BitSet &liveout) {
+      int k = first + idx;
+      const IRInstruction &ins = block.ins[idx];
+      liveout.for_each([&](int slot) {
+        extend(func->symbols.variable(slot), 2 * k + 1);
+      });
+
+      Sym def = ins.Def();
+      if (func->isVar(def)) {
+        extend(def, 2 * k + 1);
+        // a constant in memory is never stored
+        if (interval[def] != -1 && !constants.count(def)) intervals[interval[def]].uses += frequency.of(block.index);
+      }
+      for (Sym used : ins.Uses()) {
+        if (!func->isVar(used)) continue;
+        extend(used, 2 * k);
+        if (interval[used] != -1) intervals[interval[used]].uses += frequency.of(block.index);
+      }
+
+      // values live across a call are saved around it
+      if (ins.op == OP::call || ins.op == OP::callr) {
+        std::vector<Sym> &live = saved[&ins];
+        uint64_t clobbered = clobbers(func, ins);
+        liveout.for_each([&](int slot) {
+          Sym variable = func->symbols.variable(slot);
+          if (variable == def) return;
+          live.push_back(variable);
+          if (interval[variable] == -1 || !clobbered) return;
+          Interval &i = intervals[interval[variable]];
+          i.calls += dom.inLoop(block.index) ? 2 : 1;
+          i.clobbered |= clobbered;
+        });
+      }
+    });
+    first += block.ins.size();
+  }
+
+  // the parameters all arrive before the first instruction
+  for (Sym param : func->intparams) {
+    if (interval[param] != -1) intervals[interval[param]].start = -1;
+  }
+}
+
+void LinearScan::allocate() {
+  std::vector<int> order(intervals.size());
+  for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+  std::sort(order.begin(), order.end(), [&](int a, int b) {
+    return intervals[a].start < intervals[b].start;
+  });
+
+  std::vector<int> active; // intervals holding a register, by increasing end
+  std::vector<int> frees[2]; // per class
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int r = target.count(c) - 1; r >= 0; --r) frees[int(c)].push_back(r);
+  }
+
+  for (int i : order) {
+    Interval &current = intervals[i];
+    std::vector<int> &free = frees[int(current.regClass)];
+
+    // expire the intervals that ended before this one starts
+    size_t expired = 0;
+    while (expired < active.size() && intervals[active[expired]].end < current.start) {
+      const Interval &done = intervals[active[expired]];
+      frees[int(done.regClass)].push_back(done.reg);
+      ++expired;
+    }
+    active.erase(active.begin(), active.begin() + expired);
+
+    if (free.empty()) {
+      // spill the cheapest of this one and the active ones of its class
+      auto weight = [](const Interval &iv) { return iv.uses / (iv.end - iv.start + 1); };
+      size_t victim = active.size();
+      double cheapest = weight(current);
+      for (size_t a = active.size(); a-- > 0;) {
+        if (intervals[active[a]].regClass != current.regClass) continue;
+        double w = weight(intervals[active[a]]);
+        if (w < cheapest) {
+          victim = a;
+          cheapest = w;
+        }
+      }
+      if (victim == active.size()) continue; // current stays in memory
+      Interval &spilled = intervals[active[victim]];
+      current.reg = spilled.reg;
+      spilled.reg = -1;
+      active.erase(active.begin() + victim);
+    } else {
+      // a caller saved register the calls it crosses don't touch is free.
+      // Otherwise callee saved registers for values live across calls, so
+      // they don't need saving around them, and caller saved ones for
+      // everything else. A single call outside a loop is as cheap to save
+      // around.
+      auto r = std::find_if(free.rbegin(), free.rend(), [&](int reg) {
+        return !target.calleeSaved(current.regClass, reg) && !(current.clobbered & Target::mask(current.regClass, reg));
+      });
+      if (r == free.rend()) r = std::find_if(free.rbegin(), free.rend(), [&](int reg) {
+        return target.calleeSaved(current.regClass, reg) == (current.calls > 1);
+      });
+      auto pick = r == free.rend() ? free.end() - 1 : r.base() - 1;
+      current.reg = *pick;
+      free.erase(pick);
+    }
+
+    auto at = std::upper_bound(active.begin(), active.end(), current.end, [&](int end, int a) {
+      return end < intervals[a].end;
+    });
+    active.insert(at, i);
+  }
+}
+
+void LinearScan::process(Program *program, Function *cfg) {
+  this->program = program;
+  this->func = cfg;
+  saved.clear();
+
+  liveness.compute(func);
+  constants = foldConstants(func, liveness);
+  liveness.compute(func);
+  dom.compute(func);
+  frequency.compute(func, dom);
+  incoming.clear();
+  std::vector<bool> keep = registerParams(func, liveness);
+  for (size_t i = 0; i < keep.size(); ++i) {
+    if (keep[i]) incoming[func->intparams[i]] = "$a" + std::to_string(i);
+  }
+  buildIntervals();
+  allocate();
+}
+
+std::string LinearScan::registerOf(Sym variable) const {
+  if (!func->isVar(variable)) return "";
+  auto it = incoming.find(variable);
+  if (it != incoming.end()) return it->second;
+  if (interval[variable] == -1) return "";
+  const Interval &i = intervals[interval[variable]];
+  return i.reg == -1 ? "" : target.name(i.regClass, i.reg);
+}
+
+void LinearScan::enterFunction() {
+  emit("# enter " + func->name);
+  for (auto &it : incoming) {
+    emit("# variable " + func->symbols.name(it.first) + " stays in " + it.second);
+  }
+  for (const Interval &i : intervals) {
+    const std::string &name = func->symbols.name(i.variable);
+    if (i.reg != -1)
+      emit("# variable " + name + " assigned register " + target.name(i.regClass, i.reg));
+    else if (constants.count(i.variable))
+      emit("# variable " + name + " is rematerialized");
+    else
+      emit("# variable " + name + " is spilled!");
+  }
+}
+
+void LinearScan::spill(Block *block, IRInstruction *ins) {
+  emit("# spilling for jal");
+  uint64_t clobbered = clobbers(func, *ins);
+  Naive n;
+  n.process(program, func);
+  for (Sym variable : saved[ins]) {
+    if (interval[variable] == -1) continue;
+    const Interval &i = intervals[interval[variable]];
+    if (i.reg != -1 && (clobbered & mask(i))) n.store(target.name(i.regClass, i.reg), variable);
+  }
+}
+
+void LinearScan::unspill(Block *block, IRInstruction *ins) {
+  emit("# unspilling");
+  uint64_t clobbered = clobbers(func, *ins);
+  Naive n;
+  n.process(program, func);
+  for (Sym variable : saved[ins]) {
+    if (interval[variable] == -1) continue;
+    const Interval &i = intervals[interval[variable]];
+    if (i.reg != -1 && (clobbered & mask(i))) n.reg(variable, target.name(i.regClass, i.reg));
+  }
+}
+
+bool LinearScan::inMemory(Sym variable) {
+  if (incoming.count(variable)) return false;
+  if (interval[variable] == -1) return true;
+  const Interval &i = intervals[interval[variable]];
+  if (i.reg == -1) return constants.count(variable) == 0; // constants are loaded with li
+  return i.clobbered & mask(i); // saved around a call
+}
+
+std::vector<std::string> LinearScan::savedRegisters() {
+  uint64_t used = 0;
+  for (const Interval &i : intervals) {
+    if (i.reg != -1 && target.calleeSaved(i.regClass, i.reg)) used |= mask(i);
+  }
+  std::vector<std::string> saved;
+  for (RegClass c : { RegClass::integer, RegClass::floating }) {
+    for (int r = 0; r < target.count(c); ++r) {
+      if (used & Target::mask(c, r)) saved.push_back(target.name(c, r));
+    }
+  }
+  return saved;
+}
+
+std::string LinearScan::destination(Sym variable, const std::string &fallback) {
+  std::string r = registerOf(variable);
+  return r.empty() ? fallback : r;
+}
+
+std::string LinearScan::reg(Sym variable, const std::string &suggestion) {
+  std::string r = registerOf(variable);
+  auto constant = constants.find(variable);
+  if (r.empty() && constant != constants.end()) {
+    emit("li", suggestion, func->symbols.name(constant->second), "# rematerialize " + func->symbols.name(variable));
+    return suggestion;
+  }
+  if (r.empty()) {
+    Naive n;
+    n.process(program, func);
+    return n.reg(variable, suggestion);
+  }
+
+  if (suggestion != r && (suggestion.find("$a") == 0 || suggestion.find("$v") == 0 || suggestion == "$f12")) {
+    // if the target is a function parameter or return value, then we just do a move
+    move(suggestion, r, "# move of " + func->symbols.name(variable) + " to fn arg/ret");
+  }
+  return r;
+}
+
+void LinearScan::store(const std::string &reg, Sym variable) {
+  std::string r = registerOf(variable);
+  if (r.empty() && constants.count(variable)) return; // reg() loads it again
+  if (r.empty()) {
+    Naive n;
+    n.process(program, func);
+    return n.store(reg, variable);
+  }
+
+  if (reg == r) return; // already computed in place
+  if (reg[0] != '$') {
+    // not a register
+    loadImmediate(r, reg, "# store to " + func->symbols.name(variable));
+  } else {
+    move(r, reg, "# store to " + func->symbols.name(variable));
+  }
+}
+
+void LinearScan::emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) {
+  std::string r = registerOf(dest);
+  if (r.empty()) {
+    Naive n;
+    n.process(program, func);
+    return n.emitAndStore(op, dest, a2, a3);
+  }
+  emit(op, r, a2, a3);
+}
@@ -0,0 +1,220 @@
+#include "LoopInvariant.h"
+#include "Dataflow.h"
+#include "Dominators.h"
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+// Instructions that only compute a value from their operands. A div can
+// trap on zero, so it stays where the program put it, and arrays, calls and
+// jumps all do more than that.
+static bool pure(const IRInstruction &ins) {
+  switch (ins.op) {
+    case OP::assign:
+      return ins.arg3 == NO_SYM; // the other form fills an array
+    case OP::add:
+    case OP::sub:
+    case OP::mult:
+    case OP::_and:
+    case OP::_or:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// add and sub on ints trap on overflow, since arith emits the MIPS forms
+// that do, so they can only move out of a loop that always runs them
+static bool traps(const Function *function, const IRInstruction &ins) {
+  return (ins.op == OP::add || ins.op == OP::sub) && !function->isFloat(ins.arg3);
+}
+
+// labels are program wide in the asm, so the name can't be in use anywhere
+static Sym freshLabel(Program *program, Function *function, Sym header) {
+  std::string base = function->symbols.name(header) + "_pre";
+  std::string name = base;
+  for (int i = 1; program->names.find(name) != -1; ++i) name = base + std::to_string(i);
+  return function->symbols.intern(name, SymKind::label);
+}
+
+bool canAddPreheader(const Function *function, const Dominators &dom, int h) {
+  const std::vector<Block> &blocks = function->blocks;
+  if (h == 0 || blocks[h].label == NO_SYM) return false;
+  const IRInstruction &before = blocks[h - 1].ins.back();
+  return !dom.contains(h, h - 1) || before.op == OP::_goto || before.op == OP::_return;
+}
+
+void addPreheader(Program *program, Function *function, const Dominators &dom, int h,
+    const std::vector<IRInstruction> &code, const std::vector<std::vector<bool>> &dropped) {
+  std::vector<Block> &blocks = function->blocks;
+  Sym header = blocks[h].label;
+  Sym pre = freshLabel(program, function, header);
+
+  // the label of a dropped instruction goes to the next one that stays, and
+  // the jumps to it follow
+  std::vector<IRInstruction> instructions;
+  std::vector<Sym> pending;
+  std::unordered_map<Sym, Sym> renamed;
+  auto place = [&](IRInstruction &&ins) {
+    if (!pending.empty()) {
+      if (!ins.Label()) {
+        ins.label = pending.back();
+        pending.pop_back();
+      }
+      for (Sym label : pending) renamed[label] = ins.label;
+      pending.clear();
+    }
+    instructions.push_back(std::move(ins));
+  };
+  for (Block &block : blocks) {
+    bool inLoop = dom.contains(h, block.index);
+    if (block.index == h) {
+      for (size_t k = 0; k < code.size(); ++k) {
+        IRInstruction ins = code[k];
+        ins.label = k == 0 ? pre : NO_SYM;
+        place(std::move(ins));
+      }
+    }
+    bool dropping = block.index < (int) dropped.size() && !dropped[block.index].empty();
+    for (int i = 0; i < (int) block.ins.size(); ++i) {
+      IRInstruction &ins = block.ins[i];
+      if (dropping && dropped[block.index][i]) {
+        if (ins.Label()) pending.push_back(ins.label);
+        continue;
+      }
+      Sym *target = ins.TargetOperand();
+      if (!inLoop && target != nullptr && *target == header) *target = pre;
+      place(std::move(ins));
+    }
+  }
+
+  for (IRInstruction &ins : instructions) {
+    Sym *target = ins.TargetOperand();
+    if (target == nullptr) continue;
+    auto it = renamed.find(*target);
+    if (it != renamed.end()) *target = it->second;
+  }
+  createCfg(function, instructions);
+}
+
+// Move what is invariant in the loop starting at block h to a preheader.
+// Returns false, and changes nothing, if nothing can move.
+static bool hoistLoop(Program *program, Function *function, const Dominators &dom, const Liveness &liveness, int h) {
+  std::vector<Block> &blocks = function->blocks;
+  const SymbolTable &symbols = function->symbols;
+  if (!canAddPreheader(function, dom, h)) return false;
+
+  std::vector<int> body;
+  for (const Block &b : blocks) {
+    if (dom.contains(h, b.index)) body.push_back(b.index);
+  }
+
+  // where each symbol is written in the loop, and whether the loop calls
+  // anything that could write the globals
+  std::vector<int> defs(symbols.size(), 0), defBlock(symbols.size(), -1);
+  bool calls = false;
+  for (int b : body) {
+    for (const IRInstruction &ins : blocks[b].ins) {
+      calls |= ins.op == OP::call || ins.op == OP::callr;
+      Sym def = ins.Def();
+      if (def == NO_SYM) continue;
+      ++defs[def];
+      defBlock[def] = b;
+    }
+  }
+
+  // A block that dominates every block the loop is left from runs each time
+  // the loop is entered. When the header tests for the exit, as in a loop
+  // that may run zero times, only the header itself does.
+  std::vector<int> exiting;
+  for (int b : body) {
+    for (int s : blocks[b].next) {
+      if (!dom.contains(h, s)) {
+        exiting.push_back(b);
+        break;
+      }
+    }
+  }
+  auto always = [&](int b) {
+    return !exiting.empty() && std::all_of(exiting.begin(), exiting.end(), [&](int e) { return dom.dominates(b, e); });
+  };
+
+  // A value can move when it is the only write in the loop, isn't read
+  // before it on the way around, and after the loop it is either not read
+  // or was always written on the way out.
+  const BitSet &entering = liveness.liveIn(h);
+  auto movable = [&](Sym def) {
+    if (!function->isVar(def) || program->IsGlobal(function, def) || defs[def] != 1) return false;
+    int slot = symbols.slot(def);
+    if (entering.test(slot)) return false;
+    for (int b : body) {
+      for (int s : blocks[b].next) {
+        if (!dom.contains(h, s) && liveness.liveIn(s).test(slot) && !dom.dominates(defBlock[def], b)) return false;
+      }
+    }
+    return true;
+  };
+
+  // invariant[v]: v is written once in the loop, by an instruction that moves
+  std::vector<bool> invariant(symbols.size(), false);
+  auto fixed = [&](Sym s) {
+    if (program->IsGlobal(function, s)) return !calls && defs[s] == 0;
+    if (!function->isVar(s)) return true;
+    return defs[s] == 0 || invariant[s];
+  };
+
+  // in the order they are found, which puts each one after what it reads
+  std::vector<std::pair<int, int>> moved;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int b : body) {
+      for (int i = 0; i < (int) blocks[b].ins.size(); ++i) {
+        const IRInstruction &ins = blocks[b].ins[i];
+        if (!pure(ins) || (traps(function, ins) && !always(b)) || invariant[ins.Def()] || !movable(ins.Def())) continue;
+        SmallVector<Sym, 3> uses = ins.Uses();
+        if (!std::all_of(uses.begin(), uses.end(), fixed)) continue;
+        invariant[ins.Def()] = true;
+        moved.emplace_back(b, i);
+        changed = true;
+      }
+    }
+  }
+  if (moved.empty()) return false;
+
+  std::vector<IRInstruction> code;
+  std::vector<std::vector<bool>> dropped(blocks.size());
+  for (auto [b, i] : moved) {
+    code.push_back(blocks[b].ins[i]);
+    if (dropped[b].empty()) dropped[b].assign(blocks[b].ins.size(), false);
+    dropped[b][i] = true;
+  }
+  addPreheader(program, function, dom, h, code, dropped);
+  return true;
+}
+
+// One loop at a time, innermost first, working out the loops again after
+// each one that changed, since that adds a block to every loop around it.
+void hoistInvariants(Program *program, Function *function) {
+  std::set<Sym> done; // headers by label
+  for (bool again = true; again;) {
+    again = false;
+    Dominators dom;
+    dom.compute(function);
+    std::vector<int> headers;
+    for (const Block &b : function->blocks) {
+      if (dom.header(b.index) == b.index) headers.push_back(b.index);
+    }
+    if (headers.empty()) return;
+    std::stable_sort(headers.begin(), headers.end(), [&](int a, int b) { return dom.depth(a) > dom.depth(b); });
+
+    Liveness liveness;
+    liveness.compute(function);
+    for (int h : headers) {
+      if (!done.insert(function->blocks[h].label).second) continue;
+      if (hoistLoop(program, function, dom, liveness, h)) {
+        again = true;
+        break;
+      }
+    }
+  }
+}
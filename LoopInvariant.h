@@ -0,0 +1,24 @@
+#pragma once
+#include "CFG.h"
+#include "Dominators.h"
+#include <vector>
+
+// Loop invariant code motion. The instructions of a loop that compute the
+// same value every time around, don't touch memory, and can't fault (or run
+// anyway once the loop is entered) move to a new block in front of the loop
+// header (the preheader) so they run once per entry into the loop instead of
+// once per iteration. Loops are done innermost first, so a value can move
+// out through several of them. Needs the globals, so it runs after
+// Program::IndexGlobals.
+extern void hoistInvariants(Program *program, Function *function);
+
+// A preheader goes right before the loop header in the code, so there can be
+// one for the loop that starts at block h unless something in the loop falls
+// through into the header, or the header is the entry.
+extern bool canAddPreheader(const Function *function, const Dominators &dom, int h);
+// Lay the code out again with code in a new block right before the loop
+// header h, which the jumps into the loop go to from now on. The
+// instructions marked in dropped (per block and instruction, empty for a
+// block that keeps them all) are left out.
+extern void addPreheader(Program *program, Function *function, const Dominators &dom, int h,
+    const std::vector<IRInstruction> &code, const std::vector<std::vector<bool>> &dropped = {});
@@ -1,7 +1,7 @@
 #include "Strategy.h"
 #include "CFG.h"
 #include "CodeGen.h"
-#include <algorithm>
+#include "FrameLayout.h"
 #include <assert.h>
 
 void Naive::process(Program *program, Function *func) {
@@ -9,72 +9,41 @@ void Naive::process(Program *program, Function *func) {
   this->func = func;
 }
 
-int Naive::numVariables() {
-  return func->intlist.size() + func->floatlist.size();
+// Where a variable lives in memory: globals have a symbol of their own, and
+// the rest have a stack slot in the frame layout
+static std::string location(Program *program, Function *func, Sym variable) {
+  if (program->IsGlobal(func, variable)) {
+    return func->symbols.name(variable); // there is a global symbol with this name
+  }
+  assert(func->isVar(variable));
+  int offset = layout.offset(variable); // assume every variable is a word?
+  assert(offset != -1);
+  return std::to_string(offset) + "($sp)";
 }
 
-std::string Naive::reg(const std::string &variable, const std::string &suggestion) {
-  std::string to;
-  bool isfloat = false;
-  if (program->IsGlobal(variable)) {
-    to = variable; // there is a global symbol with this name
-  } else if (std::find(func->intlist.begin(), func->intlist.end(), variable) != func->intlist.end()) {
-    auto it = std::find(func->intlist.begin(), func->intlist.end(), variable);
-    assert(it != func->intlist.end());
-    int idx = std::distance(func->intlist.begin(), it);
-    int offset = 4 * idx; // assume every variable is a word?
-    to = std::to_string(offset) + "($sp)"; // load based on offset to sp
-  } else {
-    auto it = std::find(func->floatlist.begin(), func->floatlist.end(), variable);
-    assert(it != func->floatlist.end());
-    int idx = std::distance(func->floatlist.begin(), it);
-    // we offset from end of intlist
-    int offset = (func->intlist.size() * 4) + (4 * idx);
-    to = std::to_string(offset) + "($sp)"; // load based on offset to sp
-    isfloat = true;
-  }
-  emit(isfloat ? "l.s" : "lw", suggestion, to, "# load from " + variable); // load from stack into $t0
+std::string Naive::reg(Sym variable, const std::string &suggestion) {
+  std::string to = location(program, func, variable);
+  bool isfloat = !program->IsGlobal(func, variable) && func->isFloat(variable);
+  emit(isfloat ? "l.s" : "lw", suggestion, to, "# load from " + func->symbols.name(variable)); // load from stack into $t0
   return suggestion;
 }
 
-void Naive::store(const std::string &reg, const std::string &variable) {
-  std::string to;
-  bool isfloat = false;
-  if (program->IsGlobal(variable)) {
-    to = variable;
-  } else if (std::find(func->intlist.begin(), func->intlist.end(), variable) != func->intlist.end()) {
-    auto it = std::find(func->intlist.begin(), func->intlist.end(), variable);
-    assert(it != func->intlist.end());
-    int idx = std::distance(func->intlist.begin(), it);
-    int offset = 4 * idx; // assume every variable is a word?
-    to = std::to_string(offset) + "($sp)";
-  } else {
-    auto it = std::find(func->floatlist.begin(), func->floatlist.end(), variable);
-    assert(it != func->floatlist.end());
-    int idx = std::distance(func->floatlist.begin(), it);
-    // we offset from end of intlist
-    int offset = (func->intlist.size() * 4) + (4 * idx);
-    to = std::to_string(offset) + "($sp)";
-    isfloat = true;
-  }
-  
+void Naive::store(const std::string &reg, Sym variable) {
+  std::string to = location(program, func, variable);
+  bool isfloat = !program->IsGlobal(func, variable) && func->isFloat(variable);
+
   std::string r = reg;
   if (reg[0] != '$') {
     // we can't store an immediate to memory without putting it
     // into a temporary register first
-    if (!isfloat) {
-      emit("li", "$t0", reg);
-      r = "$t0";
-    } else {
-      emit("li.s", "$f0", reg);
-      r = "$f0";
-    }
+    r = isfloat ? "$f0" : "$t0";
+    loadImmediate(r, reg);
   }
 
-  emit(isfloat ? "s.s" : "sw", r, to, "# store to " + variable); // store onto stack
+  emit(isfloat ? "s.s" : "sw", r, to, "# store to " + func->symbols.name(variable)); // store onto stack
 }
 
-void Naive::emitAndStore(const std::string &op, const std::string &dest, const std::string &a2, const std::string &a3) {
+void Naive::emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) {
   bool isfloat = func->isFloat(dest);
   std::string to = isfloat ? "$f4" : "$t2";
 
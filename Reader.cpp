@@ -0,0 +1,184 @@
+#include "CFG.h"
+#include "Reader.h"
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const char *path) {
+#ifndef _WIN32
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return;
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr != MAP_FAILED) {
+      madvise(addr, st.st_size, MADV_SEQUENTIAL);
+      data = static_cast<const char *>(addr);
+      size = st.st_size;
+      mapped = true;
+    }
+  }
+  close(fd);
+  if (mapped) {
+    opened = true;
+    return;
+  }
+#endif
+  // not mappable (or an empty file), so read it the slow way
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open()) return;
+  buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  data = buffer.data();
+  size = buffer.size();
+  opened = true;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped) {
+    munmap(const_cast<char *>(data), size);
+  }
+#endif
+}
+
+static inline bool starts_with(std::string_view str, std::string_view prefix) {
+  return str.substr(0, prefix.size()) == prefix;
+}
+
+// Pull the next line out of text, without its line ending
+static inline std::string_view next_line(std::string_view &text) {
+  const char *nl = static_cast<const char *>(memchr(text.data(), '\n', text.size()));
+  size_t len = nl == nullptr ? text.size() : nl - text.data();
+  std::string_view line = text.substr(0, len);
+  text.remove_prefix(nl == nullptr ? len : len + 1);
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  return line;
+}
+
+// Split a comma separated list, e.g. the int-list, into its names
+static void parse_list(std::string_view list, std::vector<std::string_view> &out) {
+  while (!list.empty()) {
+    size_t comma = list.find(',');
+    std::string_view name = strip(list.substr(0, comma));
+    if (!name.empty()) out.push_back(name);
+    if (comma == std::string_view::npos) break;
+    list.remove_prefix(comma + 1);
+  }
+}
+
+// Intern a declaration list in order, so the variables get the first ids.
+// Arrays (X[100]) aren't variables, they go in the function's arrays.
+static void parse_list(std::string_view list, Function *function, SymKind kind, std::vector<Sym> &out) {
+  std::vector<std::string_view> names;
+  parse_list(list, names);
+  for (std::string_view name : names) {
+    size_t open = name.find('[');
+    if (open != std::string_view::npos) {
+      int length = atoi(std::string(name.substr(open + 1)).c_str());
+      function->arrays.emplace_back(function->symbols.intern(strip(name.substr(0, open)), SymKind::array), length);
+      continue;
+    }
+    out.push_back(function->symbols.intern(name, kind));
+  }
+}
+
+// rettype fnname(argtype argname, argtype argname):
+static void parse_signature(std::string_view line, std::vector<std::string_view> &params) {
+  size_t open = line.find('(');
+  size_t close = line.find(')');
+  if (open == std::string_view::npos || close == std::string_view::npos || close < open) return;
+
+  parse_list(line.substr(open + 1, close - open - 1), params);
+  for (std::string_view &param : params) {
+    // drop the type, keep the name
+    size_t idx = param.find(' ');
+    if (idx != std::string_view::npos) param = strip(param.substr(idx + 1));
+  }
+}
+
+bool readProgram(const char *path, Program &program) {
+  MappedFile file(path);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  Function *function = nullptr;
+  std::vector<std::string_view> params;
+  std::vector<IRInstruction> instructions;
+  Sym label = NO_SYM;
+  std::string_view text = file.contents();
+  while (!text.empty()) {
+    std::string_view line = strip(next_line(text));
+    if (line.empty()) continue;
+
+    if (starts_with(line, "#start_function")) {
+      function = new Function();
+      function->name = strip(line.substr(15));
+      function->symbols.names = &program.names;
+      params.clear();
+      parse_signature(next_line(text), params);
+      continue;
+    }
+
+    if (starts_with(line, "#end_function")) {
+      if (function != nullptr) {
+        // parameters are declared in the int-list too
+        for (std::string_view param : params) {
+          function->intparams.push_back(function->symbols.intern(param, SymKind::local_int));
+        }
+        // a function that runs off its end returns
+        bool ends = !instructions.empty() &&
+            (instructions.back().op == OP::_return || instructions.back().op == OP::_goto);
+        if (!ends || label != NO_SYM) {
+          instructions.emplace_back(OP::_return, NO_SYM, NO_SYM, NO_SYM);
+          instructions.back().label = label;
+        }
+        createCfg(function, instructions);
+        program.functions.push_back(function);
+      }
+      function = nullptr;
+      instructions.clear();
+      label = NO_SYM;
+      continue;
+    }
+
+    if (line[0] == '#' || function == nullptr) {
+      continue;
+    }
+
+    if (starts_with(line, "int-list:")) {
+      parse_list(line.substr(9), function, SymKind::local_int, function->intlist);
+      continue;
+    }
+
+    if (starts_with(line, "float-list:")) {
+      parse_list(line.substr(11), function, SymKind::local_float, function->floatlist);
+      continue;
+    }
+
+    if (line.find(':') == line.size() - 1) {
+      label = function->symbols.intern(line.substr(0, line.size() - 1), SymKind::label);
+      continue;
+    }
+
+    IRInstruction irins;
+    if (!parseAsm(line, function->symbols, irins)) {
+      continue;
+    }
+
+    irins.label = label;
+    label = NO_SYM;
+    instructions.push_back(std::move(irins));
+  }
+
+  return true;
+}
@@ -0,0 +1,30 @@
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Program;
+
+// Read-only view of a whole file. The file is mapped into memory where the
+// platform allows it, so the parser can slice it without copying.
+class MappedFile {
+ public:
+  explicit MappedFile(const char *path);
+  ~MappedFile();
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  bool is_open() const { return opened; }
+  std::string_view contents() const { return std::string_view(data, size); }
+
+ private:
+  bool opened = false;
+  const char *data = nullptr;
+  size_t size = 0;
+  bool mapped = false;
+  std::string buffer; // used when the file can't be mapped
+};
+
+// Parse every function in an IR file into program, interning the operands
+// and building the cfg for each one. Returns false if the file could not be
+// opened.
+extern bool readProgram(const char *path, Program &program);
@@ -0,0 +1,40 @@
+#pragma once
+#include <vector>
+
+// Vector that keeps up to N elements inline and only allocates once it
+// grows past that. Meant for small, mostly fixed-size lists like the cfg
+// edges of a block.
+template <typename T, unsigned N>
+class SmallVector {
+ public:
+  void push_back(const T &value) {
+    if (heap.empty() && count < N) {
+      local[count++] = value;
+      return;
+    }
+    if (heap.empty()) heap.assign(local, local + count);
+    heap.push_back(value);
+    ++count;
+  }
+
+  void clear() {
+    count = 0;
+    heap.clear();
+  }
+
+  unsigned size() const { return count; }
+  bool empty() const { return count == 0; }
+
+  T *begin() { return heap.empty() ? local : heap.data(); }
+  T *end() { return begin() + count; }
+  const T *begin() const { return heap.empty() ? local : heap.data(); }
+  const T *end() const { return begin() + count; }
+
+  T &operator[](unsigned i) { return begin()[i]; }
+  const T &operator[](unsigned i) const { return begin()[i]; }
+
+ private:
+  T local[N];
+  unsigned count = 0;
+  std::vector<T> heap; // only used past N elements
+};
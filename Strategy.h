@@ -1,30 +1,45 @@
+#pragma once
 #include <string>
 #include <map>
+#include <deque>
 #include <set>
-
-#define MAX_REGISTERS 8
+#include <unordered_map>
+#include <vector>
+#include "Dataflow.h"
+#include "Dominators.h"
+#include "Frequency.h"
+#include "Interference.h"
+#include "Target.h"
 
 #define NAIVE 0
 #define INTRA 1
 #define GLOBAL 2
+#define LINEAR 3
+#define EBB 4
 
-class Function;
-class Program;
-class IRInstruction;
-class Block;
 
 class Strategy {
  public:
   virtual void process(Program *program, Function *function) = 0;
   virtual void enterFunction() { }
   virtual void enterBlock(Block *block) { }
+  // before each instruction of the block is generated
+  virtual void enterInstruction(Block *block, IRInstruction *ins) { }
   virtual void exitBlock(Block *block) { }
   virtual void spill(Block *, IRInstruction *) { }
   virtual void unspill(Block *, IRInstruction *) { }
-  virtual int numVariables() = 0;
-  virtual std::string reg(const std::string &variable, const std::string &suggestion) = 0;
-  virtual void store(const std::string &reg, const std::string &variable) = 0;
-  virtual void emitAndStore(const std::string &op, const std::string &dest, const std::string &a2, const std::string &a3) = 0;
+  // whether the generated code may load or store variable in its stack
+  // slot; the frame only has room for those
+  virtual bool inMemory(Sym variable) { return true; }
+  // The callee saved registers this function writes, which the prologue
+  // saves and each return restores
+  virtual std::vector<std::string> savedRegisters() { return {}; }
+  // The register a value bound for variable should be computed into, so a
+  // copy can load straight into it. fallback if the variable has none.
+  virtual std::string destination(Sym variable, const std::string &fallback) { return fallback; }
+  virtual std::string reg(Sym variable, const std::string &suggestion) = 0;
+  virtual void store(const std::string &reg, Sym variable) = 0;
+  virtual void emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) = 0;
 };
 
 class Naive : public Strategy {
@@ -32,52 +47,176 @@ class Naive : public Strategy {
   Program *program = nullptr;
   Function *func = nullptr;
   void process(Program *, Function *cfg) override;
-  int numVariables() override;
-  std::string reg(const std::string &variable, const std::string &suggestion) override;
-  void store(const std::string &reg, const std::string &variable) override;
-  void emitAndStore(const std::string &op, const std::string &dest, const std::string &a2, const std::string &a3) override;
+  std::string reg(Sym variable, const std::string &suggestion) override;
+  void store(const std::string &reg, Sym variable) override;
+  void emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) override;
 };
 
+// Local allocation (Belady's furthest next use): registers are handed out
+// on demand while a block is generated, and when none is free the value
+// read again furthest away gives up its register. Values only go back to
+// memory when they changed and are still needed, at the end of the block
+// or before a call that overwrites their register.
 class IntraBlock : public Strategy{
+  struct Ref {
+    int position; // instruction in the block
+    bool read; // or written
+  };
+  std::unordered_map<Sym, std::vector<Ref>> refs; // variable -> its refs in the current block, in order
+  std::vector<Sym> holds[2]; // per class, the variable in each register or NO_SYM
+  std::unordered_map<Sym, int> where; // variable -> register, in its class
+  BitSet dirty; // variables whose register is newer than memory
+  int position = 0; // instruction being generated
+  const BitSet *liveout = nullptr; // of the current block
+  int registers[2] = { 0, 0 }; // the most any block can use, per class
+
+  RegClass regClass(Sym variable) const { return func->isFloat(variable) ? RegClass::floating : RegClass::integer; }
+  std::string registerOf(Sym variable) const; // empty if in memory
+  const Ref *next(Sym variable, int from) const; // first ref at or after from, nullptr if none
+  bool needed(Sym variable, int from) const; // read before it is written again, here or after the block
+  int allocate(Sym variable, int from); // a register for variable, -1 if every one holds an operand
+  void evict(RegClass c, int reg, int from);
  public:
-  std::map<std::string, int> assignments; // variable -> what register assignment
+  Liveness liveness;
   Program *program = nullptr;
   Function *func = nullptr;
   void performLivenessAnalysis();
   void process(Program *, Function *cfg) override;
   void enterBlock(Block *block) override;
+  void enterInstruction(Block *block, IRInstruction *ins) override;
+  void exitBlock(Block *block) override;
+  void spill(Block *, IRInstruction *) override;
+  void unspill(Block *, IRInstruction *) override;
+  std::vector<std::string> savedRegisters() override;
+  std::string reg(Sym variable, const std::string &suggestion) override;
+  void store(const std::string &reg, Sym variable) override;
+  void emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) override;
+};
+
+// IntraBlock over extended basic blocks: trees of blocks where every block
+// but the root has a single predecessor. Registers are assigned for a whole
+// tree, so values stay in them along its edges and only go back to memory
+// where control leaves the tree, or around calls.
+class ExtendedBlock : public Strategy {
+  std::vector<int> root; // per block, the first block of its tree
+  std::vector<std::map<Sym, int>> trees; // per root, variable -> register assignment, in its class
+  std::vector<BitSet> dirty; // per block, slots whose register is newer than memory before its last instruction
+  std::map<Sym, int> *assignments = nullptr; // of the current block's tree
+  std::unordered_map<const IRInstruction *, std::vector<Sym>> saves; // stored before each call
+  std::unordered_map<const IRInstruction *, std::vector<Sym>> restores; // loaded again after it
+  int current = 0; // block being generated
+  int registers[2] = { 0, 0 }; // the most any tree uses, per class
+  Liveness liveness;
+  Dominators dom;
+  BlockFrequency frequency;
+
+  RegClass regClass(Sym variable) const { return func->isFloat(variable) ? RegClass::floating : RegClass::integer; }
+  bool inside(int from, int to) const { return root[to] == root[from] && root[to] != to; } // a tree edge
+  std::string registerOf(Sym variable) const; // empty if in memory
+ public:
+  Program *program = nullptr;
+  Function *func = nullptr;
+  void process(Program *, Function *cfg) override;
+  void enterBlock(Block *block) override;
   void exitBlock(Block *block) override;
-  int numVariables() override;
-  std::string reg(const std::string &variable, const std::string &suggestion) override;
-  void store(const std::string &reg, const std::string &variable) override;
-  void emitAndStore(const std::string &op, const std::string &dest, const std::string &a2, const std::string &a3) override;
+  void spill(Block *, IRInstruction *) override;
+  void unspill(Block *, IRInstruction *) override;
+  std::vector<std::string> savedRegisters() override;
+  std::string reg(Sym variable, const std::string &suggestion) override;
+  void store(const std::string &reg, Sym variable) override;
+  void emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) override;
 };
 
 class Global : public Strategy{
   class Web {
    public:
-    std::string name; // variable name
+    int id; // node in the interference graph
+    Sym name; // variable
     std::set<IRInstruction *> ins; // ins in this web
-    std::set<Web *> edges; // interference graph edges
-    int color = -1; // register color, through MAX_REGISTERS
+    RegClass regClass = RegClass::integer;
+    int color = -1; // index into the target's registers of its class
+    double cost = 0; // spill cost, the defs and uses weighted by how often they run
+    int calls = 0; // jal sites it is live across, ones in loops count twice
+    uint64_t clobbered = 0; // registers those calls overwrite
+    std::vector<int> copies; // webs it is copied to or from, it tries to share their register
 
-    inline int degree() const { return edges.size(); }
+    const std::string &reg() const { return target.name(regClass, color); }
+    bool calleeSaved() const { return target.calleeSaved(regClass, color); }
+    uint64_t mask() const { return Target::mask(regClass, color); }
   };
-  std::map<std::string, Web *> webs;
+  std::vector<Web *> webs; // indexed by variable, nullptr if it has no web
+  std::deque<Web> nodes; // every web, indexed by id
+  InterferenceGraph graph;
+  BitSet spilled; // variables that live in memory, only touched by spill code
+  BitSet temps; // spill temporaries, these are never spilled again
+  BitSet fixed; // slots of variables that live in memory by name (globals)
+  Liveness liveness;
+  Dominators dom;
+  BlockFrequency frequency;
+  std::map<Sym, std::string> incoming; // parameters left in their $a register
+  std::map<Sym, std::string> outgoing; // values computed straight into the $a or $v0 register they're passed in
+  std::map<Sym, Sym> constants; // variables that only hold this immediate, reloaded with li when spilled
+
+  std::string registerOf(Sym variable) const; // empty if in memory
  public:
     Program *program = nullptr;
     Function *func = nullptr;
     void performLivenessAnalysis();
+    void splitWebs();
+    void coalesce();
+    void passInPlace();
     void buildWebs();
     void buildInterferenceGraph();
-    void color();
+    bool color(std::vector<Sym> &spills);
+    void insertSpillCode(const std::vector<Sym> &spills);
 
     void process(Program *, Function *cfg) override;
     void enterFunction() override;
     void spill(Block *, IRInstruction *) override;
     void unspill(Block *, IRInstruction *) override;
-    int numVariables() override;
-    std::string reg(const std::string &variable, const std::string &suggestion) override;
-    void store(const std::string &reg, const std::string &variable) override;
-    void emitAndStore(const std::string &op, const std::string &dest, const std::string &a2, const std::string &a3) override;
+    bool inMemory(Sym variable) override;
+    std::vector<std::string> savedRegisters() override;
+    std::string destination(Sym variable, const std::string &fallback) override;
+    std::string reg(Sym variable, const std::string &suggestion) override;
+    void store(const std::string &reg, Sym variable) override;
+    void emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) override;
+};
+
+class LinearScan : public Strategy {
+  struct Interval {
+    Sym variable;
+    RegClass regClass;
+    int start, end; // positions, see LinearScan.cpp
+    int reg; // index into the target's registers of its class, -1 if it lives in memory
+    double uses; // defs and uses weighted by how often they run, for picking what to spill
+    int calls; // jal sites it is live across, ones in loops count twice
+    uint64_t clobbered; // registers those calls overwrite
+  };
+  std::vector<Interval> intervals;
+  std::vector<int> interval; // per symbol, index into intervals or -1
+  std::unordered_map<const IRInstruction *, std::vector<Sym>> saved; // live across each call
+  Liveness liveness;
+  Dominators dom;
+  BlockFrequency frequency;
+  std::map<Sym, std::string> incoming; // parameters left in their $a register
+  std::map<Sym, Sym> constants; // variables that only hold this immediate, loaded with li when in memory
+
+  void buildIntervals();
+  void allocate();
+  uint64_t mask(const Interval &i) const { return Target::mask(i.regClass, i.reg); }
+  std::string registerOf(Sym variable) const; // empty if in memory
+ public:
+  Program *program = nullptr;
+  Function *func = nullptr;
+
+  void process(Program *, Function *cfg) override;
+  void enterFunction() override;
+  void spill(Block *, IRInstruction *) override;
+  void unspill(Block *, IRInstruction *) override;
+  bool inMemory(Sym variable) override;
+  std::vector<std::string> savedRegisters() override;
+  std::string destination(Sym variable, const std::string &fallback) override;
+  std::string reg(Sym variable, const std::string &suggestion) override;
+  void store(const std::string &reg, Sym variable) override;
+  void emitAndStore(const std::string &op, Sym dest, const std::string &a2, const std::string &a3) override;
 };
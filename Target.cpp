@@ -0,0 +1,34 @@
+#include "Target.h"
+#include <algorithm>
+#include <limits>
+
+Target target;
+
+static const char *const callerSavedInt[] = { "$t3", "$t4", "$t5", "$t6", "$t7", "$t8", "$t9", "$v1" };
+static const char *const calleeSavedInt[] = { "$s0", "$s1", "$s2", "$s3", "$s4", "$s5", "$s6", "$s7" };
+// single precision, so every other float register is enough
+static const char *const callerSavedFloat[] = { "$f6", "$f8", "$f10", "$f14", "$f16", "$f18" };
+static const char *const calleeSavedFloat[] = { "$f20", "$f22", "$f24", "$f26", "$f28", "$f30" };
+
+template <size_t Caller, size_t Callee>
+static std::vector<Register> registerFile(RegClass c, const char *const (&caller)[Caller],
+    const char *const (&callee)[Callee], size_t n) {
+  // split n between the two kinds, as evenly as they allow
+  size_t saved = std::min(Callee, n / 2);
+  size_t scratch = std::min(Caller, n - saved);
+  saved = std::min(Callee, n - scratch);
+
+  std::vector<Register> regs;
+  for (size_t i = 0; i < scratch; ++i) regs.push_back(Register { caller[i], c, false });
+  for (size_t i = 0; i < saved; ++i) regs.push_back(Register { callee[i], c, true });
+  return regs;
+}
+
+Target::Target() {
+  limit(std::numeric_limits<int>::max());
+}
+
+void Target::limit(int n) {
+  allocatable[int(RegClass::integer)] = registerFile(RegClass::integer, callerSavedInt, calleeSavedInt, n);
+  allocatable[int(RegClass::floating)] = registerFile(RegClass::floating, callerSavedFloat, calleeSavedFloat, n);
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class RegClass { integer, floating };
+
+struct Register {
+  std::string name;
+  RegClass regClass;
+  bool calleeSaved; // survives a jal; a function that writes it saves it first
+};
+
+// The MIPS register file, as the allocators see it. Registers with a fixed
+// job are never handed out:
+//
+//  $zero, $at, $k0, $k1, $gp, $sp, $fp, $ra
+//  $v0            return values and syscall numbers
+//  $a0 - $a3      arguments
+//  $t0 - $t2      scratch for operands and results that live in memory
+//                 (Naive, arith, branch)
+//  $f0, $f2, $f4  the same for floats
+//  $f12           float syscall argument
+//
+// Everything else is allocatable. The caller saved ($t3 - $t9, $v1) and the
+// callee saved ($s0 - $s7) registers are listed separately, so values that
+// live across a call can go where the call won't clobber them.
+class Target {
+ public:
+  Target();
+
+  // Only allocate n registers of each class, half of them callee saved, for
+  // register pressure experiments
+  void limit(int n);
+
+  // the allocatable registers, caller saved ones first
+  const std::vector<Register> &registers(RegClass c) const { return allocatable[int(c)]; }
+  int count(RegClass c) const { return allocatable[int(c)].size(); }
+  const std::string &name(RegClass c, int reg) const { return allocatable[int(c)][reg].name; }
+  bool calleeSaved(RegClass c, int reg) const { return allocatable[int(c)][reg].calleeSaved; }
+
+  // register sets are uint64_t masks: the int registers from bit 0, the
+  // float ones from bit 32
+  static uint64_t mask(RegClass c, int reg) { return uint64_t(1) << (reg + 32 * int(c)); }
+
+ private:
+  std::vector<Register> allocatable[2];
+};
+
+extern Target target;
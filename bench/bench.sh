@@ -0,0 +1,45 @@
+#!/bin/bash
+# Compile time and generated code size for every allocation strategy.
+#
+#   bench/bench.sh [path/to/phase2]
+#
+# Run from the repository root. Compiles the test programs and a few large
+# generated functions (see bench/gen.sh) with each strategy and prints one
+# row per run: compile time, and the static number of instructions, loads
+# and stores in out.s. Then, for test/leaf.ir, the size of the leaf function
+# twice_plus: it is straight-line code, so that is also the number of
+# instructions each call to it executes. Note that this clobbers out.s.
+
+set -e
+
+phase2=${1:-./phase2}
+strategies="naive intra ebb global linear"
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+bench/gen.sh blocks 10000 > "$tmp/blocks10000.ir"
+bench/gen.sh temps 2000 > "$tmp/temps2000.ir"
+bench/gen.sh temps 20000 > "$tmp/temps20000.ir"
+
+printf "%-16s %-8s %10s %8s %8s %8s\n" program strategy compile_ms ins lw sw
+for ir in test/42.ir test/condition.ir test/call.ir test/factorial.ir test/pressure.ir test/leaf.ir test/floats.ir \
+    "$tmp/blocks10000.ir" "$tmp/temps2000.ir" "$tmp/temps20000.ir"; do
+  for s in $strategies; do
+    start=$(date +%s%N)
+    "$phase2" "$ir" $s > /dev/null
+    end=$(date +%s%N)
+    # instructions are the lines that aren't labels, directives or comments
+    ins=$(grep -vcE '^[[:space:]]*($|#|\.|[A-Za-z0-9_$.]+:)' out.s || true)
+    lw=$(grep -cE '^(lw|l\.s),' out.s || true)
+    sw=$(grep -cE '^(sw|s\.s),' out.s || true)
+    printf "%-16s %-8s %10d %8d %8d %8d\n" "$(basename "$ir" .ir)" $s $(( (end - start) / 1000000 )) $ins $lw $sw
+  done
+done
+
+echo
+printf "%-8s %8s\n" strategy per_call
+for s in $strategies; do
+  "$phase2" test/leaf.ir $s > /dev/null
+  ins=$(awk '/^twice_plus:/ { f = 1; next } /^[A-Za-z0-9_$.]+:/ { f = 0 } f && !/^#/' out.s | wc -l)
+  printf "%-8s %8d\n" $s $ins
+done
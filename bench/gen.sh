@@ -0,0 +1,49 @@
+#!/bin/bash
+# Generates large machine-made IR functions for benchmarking the allocators.
+#
+#   bench/gen.sh blocks N   one function with 3N small blocks (diamonds)
+#   bench/gen.sh temps N    one straight-line function with N temporaries,
+#                           about 16 of them live at any point
+
+set -e
+
+case "$1" in
+  blocks)
+    awk -v n="$2" 'BEGIN {
+      print "#start_function main"
+      print "void main():"
+      print "int-list: s, i"
+      print "float-list: "
+      print "  assign, s, 0, "
+      print "  assign, i, 0, "
+      for (k = 0; k < n; ++k) {
+        printf "  brgt, i, %d, L%d\n  add, s, 1, s\n  goto, M%d, , \n", k % 7, k, k
+        printf "L%d:\n  add, s, 2, s\nM%d:\n  add, i, 1, i\n", k, k
+      }
+      print "  call, printi, s"
+      print "  return, , , "
+      print "#end_function main"
+    }'
+    ;;
+  temps)
+    awk -v n="$2" 'BEGIN {
+      print "#start_function main"
+      print "void main():"
+      list = "t0"
+      for (k = 1; k < n; ++k) list = list ", t" k
+      print "int-list: " list
+      print "float-list: "
+      for (k = 0; k < n; ++k) {
+        if (k < 16) printf "  assign, t%d, %d, \n", k, k
+        else printf "  add, t%d, 1, t%d\n", k - 16, k
+      }
+      printf "  call, printi, t%d\n", n - 1
+      print "  return, , , "
+      print "#end_function main"
+    }'
+    ;;
+  *)
+    echo "usage: $0 blocks|temps N" >&2
+    exit 1
+    ;;
+esac
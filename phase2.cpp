@@ -1,34 +1,67 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <map>
+#include <algorithm>
 #include "CFG.h"
 #include "CodeGen.h"
+#include "Reader.h"
 #include "Strategy.h"
+#include "CallGraph.h"
+#include "LoopInvariant.h"
+#include "Induction.h"
 #include <sstream>
-
-static inline void strip(std::string &str) {
-  while (str.length() > 0 && (str[str.length() - 1] == ',' || str[str.length() - 1] == ' '
-        || str[str.length() - 1] == '\t')) {
-    str.erase(str.length() - 1);
-  }
-  while (str.length() > 0 && (str[0] == ',' || str[0] == ' ' || str[0] == '\t')) {
-    str.erase(0, 1);
+#include <cstdlib>
+
+// Allocate registers for one function with the chosen strategy and
+// generate its code
+static std::string compile(Function *function, int reg_alloc_scheme) {
+  switch(reg_alloc_scheme){
+    case NAIVE:
+      strat = new Naive();
+      break;
+    case INTRA:
+      strat = new IntraBlock();
+      break;
+    case EBB:
+      strat = new ExtendedBlock();
+      break;
+    case GLOBAL:
+      strat = new Global();
+      break;
+    case LINEAR:
+      strat = new LinearScan();
+      break;
+    default:
+      // Should never get here
+      std::cout << "Specify naive, intra, ebb, global, or linear" << std::endl;
   }
-  std::cout << str <<std::endl;
+
+  strat->process(program, function);
+  std::stringstream s;
+  s << function->name << ":" << std::endl;
+  ::out = &s;
+  generate(function, s);
+  ::out = nullptr;
+  return s.str();
 }
 
 int main(int argc, char **argv) {
 
-  if(argc != 3){
-    std::cerr << "Usage   : ./phase2 <filename> <reg_alloc_scheme>" << std::endl;
+  if(argc != 3 && argc != 4){
+    std::cerr << "Usage   : ./phase2 <filename> <reg_alloc_scheme> [num_registers]" << std::endl;
     std::cerr << "Example : ./phase2 test/42.ir naive" << std::endl;
     return -1;
   }
 
-  std::ifstream in(argv[1]);
-  if (!in.is_open()) {
-    std::cerr << "error opening file " << argv[1] << std::endl;
-    return -1;
+  if(argc == 4){
+    // allocate fewer registers, for register pressure experiments
+    int n = atoi(argv[3]);
+    if(n <= 0){
+      std::cerr << "Number of registers must be positive." << std::endl;
+      return -1;
+    }
+    target.limit(n);
   }
 
   int reg_alloc_scheme = -1;
@@ -37,147 +70,79 @@ int main(int argc, char **argv) {
     reg_alloc_scheme = NAIVE;
   } else if(std::string(argv[2]) == "intra"){
     reg_alloc_scheme = INTRA;
+  } else if(std::string(argv[2]) == "ebb"){
+    reg_alloc_scheme = EBB;
   } else if(std::string(argv[2]) == "global"){
     reg_alloc_scheme = GLOBAL;
+  } else if(std::string(argv[2]) == "linear"){
+    reg_alloc_scheme = LINEAR;
   } else{
     std::cerr << "Reg alloc scheme not supported." << std::endl;
-    std::cerr << "Supported options are naive, intra, global" << std::endl;
+    std::cerr << "Supported options are naive, intra, ebb, global, linear" << std::endl;
     return -1;
   }
 
 
-  std::vector<Function *> functions;
-  Function *function = nullptr;
-  std::vector<IRInstruction> instructions;
-  std::string label;
-  for (std::string line; std::getline(in, line);) {
-    if (line.empty()) continue;
-
-    if (line.find("#start_function") == 0) {
-      function = new Function();
-
-      function->name = line.substr(16);
-
-      std::getline(in, line); // get signature
-      // rettype fnname ( argtype argname )
-
-      std::stringstream fnstream(line);
-      std::string rettype, fnname, parambuf;
-
-      std::getline(fnstream, rettype, ' ');
-      std::getline(fnstream, fnname, '(');
-      std::getline(fnstream, parambuf, ')');
-
-      std::cout << " FUNCTION " << rettype << " " << fnname << " " << parambuf << std::endl;
-
-      std::stringstream paramstrea(parambuf);
-      while (std::getline(paramstrea, parambuf, ',')) {
-        size_t idx = parambuf.find(' ');
-        std::string type = parambuf.substr(0, idx);
-        std::string name = parambuf.substr(idx+1);
-        std::cout << " PARAM " << name << " " << type << std::endl;
-
-        function->intparams.push_back(name);
-     }
-
-      continue;
-    }
-
-    if (line.find("#end_function") == 0) {
-      Block *block = createCfg(instructions);
-      function->start = block;
-
-      functions.push_back(function);
-      function = nullptr;
-
-      instructions.clear();
-      label.clear();
-    }
+  program = new Program();
+  if (!readProgram(argv[1], *program)) {
+    std::cerr << "error opening file " << argv[1] << std::endl;
+    return -1;
+  }
+  const std::vector<Function *> &functions = program->functions;
+  // before anything looks at the blocks, so code nothing reaches doesn't
+  // make a variable global either
+  for (Function *function : functions) simplifyCfg(function);
+  program->IndexGlobals();
+  for (Function *function : functions) {
+    hoistInvariants(program, function);
+    reduceInductions(program, function);
+  }
 
-    if (line.find("int-list: ") == 0) {
-      std::stringstream ilist(line.substr(10));
-      std::string buf;
-      while (std::getline(ilist, buf, ',')) {
-        strip(buf);
-        std::cout << "INT " << buf << std::endl;
-        function->intlist.push_back(buf);
-        // std::cout << "INT " << buf << std::endl;
-      }
-      continue;
+  // Compile callees before their callers, so each call site knows which
+  // registers the call really overwrites. The code still comes out in the
+  // order of the file.
+  CallGraph graph(program);
+  std::map<Function *, std::string> code;
+  for (const std::vector<Function *> &scc : graph.components()) {
+    uint64_t clobbers = 0;
+    for (Function *function : scc) {
+      code[function] = compile(function, reg_alloc_scheme);
+      clobbers |= clobbered();
     }
 
-    if (line.find("float-list: ") == 0) {
-      std::stringstream ilist(line.substr(12));
-      std::string buf;
-      while (std::getline(ilist, buf, ',')) {
-        strip(buf);
-        function->floatlist.push_back(buf);
+    // a cycle of calls can end up in any of its members, so they share one
+    // summary
+    for (Function *function : scc) {
+      if (graph.callsUnknown(function)) clobbers = ~uint64_t(0);
+      for (Function *callee : graph.callees(function)) {
+        if (std::find(scc.begin(), scc.end(), callee) == scc.end()) clobbers |= callee->clobbers;
       }
-      continue;
-    }
-
-    if (line.find(':') == line.length()-1) {
-      label = line.substr(0, line.length() - 1);
-      continue;
-    }
-
-    IRInstruction irins;
-    try {
-      irins = parseAsm(line);
-    } catch( ...) {
-      continue;
     }
-
-    irins.label = label;
-    label.clear();
-    instructions.push_back(irins);
-    // std::cout << "IrIns ---------------------------" << std::endl;
-    // std::cout << irins << std::endl;
-    // std::cout << "End IrIns ---------------------------" << std::endl;
-
+    for (Function *function : scc) function->clobbers = clobbers;
   }
-
-  in.close();
-
   std::stringstream out;
 //  out << ".globl main" << std::endl;
-  program = new Program();
-  program->functions = functions;
 
+  // the float constants are only known once the code is generated
   const std::vector<std::string> &globalInts = program->GetGlobalInts();
-  if (!globalInts.empty()) {
+  const std::vector<std::pair<std::string, int>> &arrays = program->GetArrays();
+  const std::vector<std::pair<std::string, std::string>> &floats = floatConstants();
+  if (!globalInts.empty() || !arrays.empty() || !floats.empty()) {
     out << ".data" << std::endl;
     for (const std::string &s : globalInts) {
       out << s << ": .word 0" << std::endl;
     }
+    for (const auto &array : arrays) {
+      out << array.first << ": .space " << 4 * array.second << std::endl;
+    }
+    for (const auto &constant : floats) {
+      out << constant.first << ": .float " << constant.second << std::endl;
+    }
   }
 
   out << ".text" << std::endl;
-
   for (Function *function : functions) {
-    switch(reg_alloc_scheme){
-      case NAIVE:
-        strat = new Naive();
-        break;
-      case INTRA:
-        strat = new IntraBlock();
-        break;
-      case GLOBAL:
-        strat = new Global();
-        //return -1;
-        break;
-      default:
-        // Should never get here
-        std::cout << "Specify naive, intra, or global" << std::endl;
-    }
-
-    strat->process(program, function);
-    out << function->name << ":" << std::endl;
-    ::out = &out;
-    generate(function, out);
-    ::out = nullptr;
-    // std::cout << "OUTPUT---------------------------" << std::endl;
-    // std::cout << out.str() << std::endl;
+    out << code[function];
   }
 
 //  delete block;
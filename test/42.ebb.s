@@ -0,0 +1,12 @@
+.text
+main:
+# start of extended block - loading into registers
+# variable $temp1 is assigned register $t4
+# variable i is assigned register $t3
+li, $t0, 40
+add, $t4, $t0, 2
+move, $t3, $t4
+move, $a0, $t3, # move of i to fn arg/ret
+li, $v0, 1
+syscall, # printi
+jr, $ra
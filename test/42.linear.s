@@ -0,0 +1,11 @@
+.text
+main:
+# enter main
+# variable i assigned register $t3
+# variable $temp1 assigned register $t3
+li, $t0, 40
+add, $t3, $t0, 2
+move, $a0, $t3, # move of i to fn arg/ret
+li, $v0, 1
+syscall, # printi
+jr, $ra
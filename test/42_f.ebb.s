@@ -0,0 +1,16 @@
+.data
+_float0: .float 40.0
+_float1: .float 2.0
+.text
+main:
+# start of extended block - loading into registers
+# variable $temp1 is assigned register $f8
+# variable i is assigned register $f6
+l.s, $f0, _float0
+l.s, $f2, _float1
+add.s, $f8, $f0, $f2
+mov.s, $f6, $f8
+mov.s, $f12, $f6, # move of i to fn arg/ret
+li, $v0, 2
+syscall, # printf
+jr, $ra
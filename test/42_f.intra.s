@@ -0,0 +1,16 @@
+.data
+_float0: .float 40.0
+_float1: .float 2.0
+.text
+main:
+# start of block
+l.s, $f0, _float0
+l.s, $f2, _float1
+add.s, $f6, $f0, $f2
+mov.s, $f8, $f6
+mov.s, $f12, $f8, # move of i to fn arg/ret
+li, $v0, 2
+syscall, # printf
+# begin spilling
+# end of block
+jr, $ra
@@ -0,0 +1,15 @@
+.data
+_float0: .float 40.0
+_float1: .float 2.0
+.text
+main:
+# enter main
+# variable i assigned register $f6
+# variable $temp1 assigned register $f6
+l.s, $f0, _float0
+l.s, $f2, _float1
+add.s, $f6, $f0, $f2
+mov.s, $f12, $f6, # move of i to fn arg/ret
+li, $v0, 2
+syscall, # printf
+jr, $ra
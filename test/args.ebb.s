@@ -0,0 +1,162 @@
+.text
+weigh:
+addiu, $sp, $sp, -60
+sw, $s0, 28($sp)
+sw, $s1, 32($sp)
+sw, $s2, 36($sp)
+sw, $s3, 40($sp)
+sw, $s4, 44($sp)
+sw, $s5, 48($sp)
+sw, $s6, 52($sp)
+sw, $s7, 56($sp)
+sw, $a0, 0($sp), # store to a
+sw, $a1, 4($sp), # store to b
+sw, $a2, 8($sp), # store to c
+sw, $a3, 12($sp), # store to d
+lw, $t0, 60($sp), # parameter 4
+sw, $t0, 16($sp), # store to e
+lw, $t0, 64($sp), # parameter 5
+sw, $t0, 20($sp), # store to f
+# start of extended block - loading into registers
+# variable a is assigned register $s7
+lw, $s7, 0($sp), # load from a
+# variable b is assigned register $s6
+lw, $s6, 4($sp), # load from b
+# variable c is assigned register $s5
+lw, $s5, 8($sp), # load from c
+# variable d is assigned register $s4
+lw, $s4, 12($sp), # load from d
+# variable e is assigned register $s3
+lw, $s3, 16($sp), # load from e
+# variable f is assigned register $s2
+lw, $s2, 20($sp), # load from f
+# variable $temp0 is assigned register $s1
+# variable $temp1 is assigned register $s0
+# variable $temp2 is assigned register $v1
+# variable $temp3 is assigned register $t9
+# variable $temp4 is assigned register $t8
+# variable $temp5 is assigned register $t7
+# variable $temp6 is assigned register $t6
+# variable $temp7 is assigned register $t5
+# variable $temp8 is assigned register $t4
+# variable $temp9 is assigned register $t3
+mul, $s1, $s6, 2
+add, $s0, $s7, $s1
+mul, $v1, $s5, 3
+add, $t9, $s0, $v1
+mul, $t8, $s4, 4
+add, $t7, $t9, $t8
+mul, $t6, $s3, 5
+add, $t5, $t7, $t6
+mul, $t4, $s2, 6
+add, $t3, $t5, $t4
+move, $v0, $t3, # move of $temp9 to fn arg/ret
+lw, $s0, 28($sp)
+lw, $s1, 32($sp)
+lw, $s2, 36($sp)
+lw, $s3, 40($sp)
+lw, $s4, 44($sp)
+lw, $s5, 48($sp)
+lw, $s6, 52($sp)
+lw, $s7, 56($sp)
+addiu, $sp, $sp, 60
+jr, $ra
+twice:
+addiu, $sp, $sp, -28
+sw, $ra, 24($sp)
+sw, $a0, 0($sp), # store to x
+sw, $a1, 4($sp), # store to y
+sw, $a2, 8($sp), # store to z
+sw, $a3, 12($sp), # store to w
+lw, $t0, 28($sp), # parameter 4
+sw, $t0, 16($sp), # store to v
+# start of extended block - loading into registers
+# variable x is assigned register $t3
+lw, $t3, 0($sp), # load from x
+# variable y is assigned register $t8
+lw, $t8, 4($sp), # load from y
+# variable z is assigned register $t7
+lw, $t7, 8($sp), # load from z
+# variable w is assigned register $t6
+lw, $t6, 12($sp), # load from w
+# variable v is assigned register $t5
+lw, $t5, 16($sp), # load from v
+# variable $temp0 is assigned register $t9
+# variable $temp1 is assigned register $t4
+# spilling for jal
+move, $a0, $t3, # move of x to fn arg/ret
+move, $a1, $t8, # move of y to fn arg/ret
+move, $a2, $t7, # move of z to fn arg/ret
+move, $a3, $t6, # move of w to fn arg/ret
+sw, $t5, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+lw, $t3, 0($sp), # load from x
+lw, $t8, 4($sp), # load from y
+lw, $t7, 8($sp), # load from z
+lw, $t6, 12($sp), # load from w
+lw, $t5, 16($sp), # load from v
+move, $t9, $v0
+# spilling for jal
+move, $a0, $t5, # move of v to fn arg/ret
+move, $a1, $t6, # move of w to fn arg/ret
+move, $a2, $t7, # move of z to fn arg/ret
+move, $a3, $t8, # move of y to fn arg/ret
+sw, $t3, -8($sp), # argument 4
+sw, $t9, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+lw, $t3, 0($sp), # load from x
+move, $t4, $v0
+add, $t4, $t4, $t3
+move, $v0, $t4, # move of $temp1 to fn arg/ret
+lw, $ra, 24($sp)
+addiu, $sp, $sp, 28
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of extended block - loading into registers
+# variable $temp0 is assigned register $t4
+# variable $temp1 is assigned register $t3
+# spilling for jal
+li, $a0, 1
+li, $a1, 2
+li, $a2, 3
+li, $a3, 4
+li, $t0, 5
+sw, $t0, -4($sp), # argument 4
+addiu, $sp, $sp, -4
+jal, twice
+addiu, $sp, $sp, 4
+# unspilling
+move, $t4, $v0
+move, $a0, $t4, # move of $temp0 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+li, $a0, 6
+li, $a1, 5
+li, $a2, 4
+li, $a3, 3
+li, $t0, 2
+sw, $t0, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of $temp1 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
@@ -0,0 +1,121 @@
+.text
+weigh:
+# enter weigh
+# variable a stays in $a0
+# variable b stays in $a1
+# variable c stays in $a2
+# variable d stays in $a3
+# variable $temp9 goes straight to $v0
+# variable e assigned register $t5
+# variable f assigned register $t4
+# variable $temp0 assigned register $t3
+# variable $temp1 assigned register $t3
+# variable $temp2 assigned register $t6
+# variable $temp3 assigned register $t3
+# variable $temp4 assigned register $t6
+# variable $temp5 assigned register $t3
+# variable $temp6 assigned register $t5
+# variable $temp7 assigned register $t3
+# variable $temp8 assigned register $t4
+addiu, $sp, $sp, -8
+lw, $t5, 8($sp), # parameter 4
+lw, $t4, 12($sp), # parameter 5
+mul, $t3, $a1, 2
+add, $t3, $a0, $t3
+mul, $t6, $a2, 3
+add, $t3, $t3, $t6
+mul, $t6, $a3, 4
+add, $t3, $t3, $t6
+mul, $t5, $t5, 5
+add, $t3, $t3, $t5
+mul, $t4, $t4, 6
+add, $v0, $t3, $t4
+addiu, $sp, $sp, 8
+jr, $ra
+twice:
+# enter twice
+# variable $temp1.10 goes straight to $v0
+# variable x assigned register $t7
+# variable y assigned register $t8
+# variable z assigned register $t9
+# variable w assigned register $v1
+# variable v assigned register $t3
+# variable $temp0 assigned register $t4
+# variable $temp1 assigned register $t3
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+move, $t7, $a0, # store to x
+move, $t8, $a1, # store to y
+move, $t9, $a2, # store to z
+move, $v1, $a3, # store to w
+lw, $t3, 8($sp), # parameter 4
+# spilling for jal
+sw, $t3, 0($sp), # store to v
+move, $a0, $t7, # move of x to fn arg/ret
+move, $a1, $t8, # move of y to fn arg/ret
+move, $a2, $t9, # move of z to fn arg/ret
+move, $a3, $v1, # move of w to fn arg/ret
+sw, $t3, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+lw, $t3, 0($sp), # load from v
+move, $t4, $v0, # store to $temp0
+# spilling for jal
+move, $a0, $t3, # move of v to fn arg/ret
+move, $a1, $v1, # move of w to fn arg/ret
+move, $a2, $t9, # move of z to fn arg/ret
+move, $a3, $t8, # move of y to fn arg/ret
+sw, $t7, -8($sp), # argument 4
+sw, $t4, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $t3, $v0, # store to $temp1
+add, $v0, $t3, $t7
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+# enter main
+# variable $temp0 goes straight to $a0
+# variable $temp1 goes straight to $a0
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# spilling for jal
+li, $a0, 1
+li, $a1, 2
+li, $a2, 3
+li, $a3, 4
+li, $t0, 5
+sw, $t0, -4($sp), # argument 4
+addiu, $sp, $sp, -4
+jal, twice
+addiu, $sp, $sp, 4
+# unspilling
+move, $a0, $v0, # store to $temp0
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+li, $a0, 6
+li, $a1, 5
+li, $a2, 4
+li, $a3, 3
+li, $t0, 2
+sw, $t0, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $a0, $v0, # store to $temp1
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
@@ -0,0 +1,135 @@
+.text
+weigh:
+addiu, $sp, $sp, -60
+sw, $s0, 28($sp)
+sw, $s1, 32($sp)
+sw, $s2, 36($sp)
+sw, $s3, 40($sp)
+sw, $s4, 44($sp)
+sw, $s5, 48($sp)
+sw, $s6, 52($sp)
+sw, $s7, 56($sp)
+sw, $a0, 0($sp), # store to a
+sw, $a1, 4($sp), # store to b
+sw, $a2, 8($sp), # store to c
+sw, $a3, 12($sp), # store to d
+lw, $t0, 60($sp), # parameter 4
+sw, $t0, 16($sp), # store to e
+lw, $t0, 64($sp), # parameter 5
+sw, $t0, 20($sp), # store to f
+# start of block
+lw, $t3, 4($sp), # load from b
+mul, $t4, $t3, 2
+lw, $t5, 0($sp), # load from a
+add, $t6, $t5, $t4
+lw, $t7, 8($sp), # load from c
+mul, $t8, $t7, 3
+add, $t9, $t6, $t8
+lw, $v1, 12($sp), # load from d
+mul, $s0, $v1, 4
+add, $s1, $t9, $s0
+lw, $s2, 16($sp), # load from e
+mul, $s3, $s2, 5
+add, $s4, $s1, $s3
+lw, $s5, 20($sp), # load from f
+mul, $s6, $s5, 6
+add, $s7, $s4, $s6
+# begin spilling
+# end of block
+move, $v0, $s7, # move of $temp9 to fn arg/ret
+lw, $s0, 28($sp)
+lw, $s1, 32($sp)
+lw, $s2, 36($sp)
+lw, $s3, 40($sp)
+lw, $s4, 44($sp)
+lw, $s5, 48($sp)
+lw, $s6, 52($sp)
+lw, $s7, 56($sp)
+addiu, $sp, $sp, 60
+jr, $ra
+twice:
+addiu, $sp, $sp, -28
+sw, $ra, 24($sp)
+sw, $a0, 0($sp), # store to x
+sw, $a1, 4($sp), # store to y
+sw, $a2, 8($sp), # store to z
+sw, $a3, 12($sp), # store to w
+lw, $t0, 28($sp), # parameter 4
+sw, $t0, 16($sp), # store to v
+# start of block
+# spilling for jal
+lw, $a0, 0($sp), # load from x
+lw, $a1, 4($sp), # load from y
+lw, $a2, 8($sp), # load from z
+lw, $a3, 12($sp), # load from w
+lw, $t3, 16($sp), # load from v
+sw, $t3, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $t3, $v0
+# spilling for jal
+lw, $a0, 16($sp), # load from v
+lw, $a1, 12($sp), # load from w
+lw, $a2, 8($sp), # load from z
+lw, $a3, 4($sp), # load from y
+lw, $t4, 0($sp), # load from x
+sw, $t4, -8($sp), # argument 4
+sw, $t3, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $t3, $v0
+lw, $t4, 0($sp), # load from x
+add, $t3, $t3, $t4
+# begin spilling
+# end of block
+move, $v0, $t3, # move of $temp1 to fn arg/ret
+lw, $ra, 24($sp)
+addiu, $sp, $sp, 28
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of block
+# spilling for jal
+li, $a0, 1
+li, $a1, 2
+li, $a2, 3
+li, $a3, 4
+li, $t0, 5
+sw, $t0, -4($sp), # argument 4
+addiu, $sp, $sp, -4
+jal, twice
+addiu, $sp, $sp, 4
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of $temp0 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+li, $a0, 6
+li, $a1, 5
+li, $a2, 4
+li, $a3, 3
+li, $t0, 2
+sw, $t0, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of $temp1 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
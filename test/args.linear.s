@@ -0,0 +1,124 @@
+.text
+weigh:
+# enter weigh
+# variable a stays in $a0
+# variable b stays in $a1
+# variable c stays in $a2
+# variable d stays in $a3
+# variable e assigned register $t3
+# variable f assigned register $t4
+# variable $temp9 assigned register $t4
+# variable $temp7 assigned register $t3
+# variable $temp8 assigned register $t4
+# variable $temp5 assigned register $t5
+# variable $temp6 assigned register $t3
+# variable $temp3 assigned register $t6
+# variable $temp4 assigned register $t5
+# variable $temp1 assigned register $t5
+# variable $temp2 assigned register $t6
+# variable $temp0 assigned register $t5
+addiu, $sp, $sp, -8
+lw, $t3, 8($sp), # parameter 4
+lw, $t4, 12($sp), # parameter 5
+mul, $t5, $a1, 2
+add, $t5, $a0, $t5
+mul, $t6, $a2, 3
+add, $t6, $t5, $t6
+mul, $t5, $a3, 4
+add, $t5, $t6, $t5
+mul, $t3, $t3, 5
+add, $t3, $t5, $t3
+mul, $t4, $t4, 6
+add, $t4, $t3, $t4
+move, $v0, $t4, # move of $temp9 to fn arg/ret
+addiu, $sp, $sp, 8
+jr, $ra
+twice:
+# enter twice
+# variable x assigned register $t7
+# variable y assigned register $t8
+# variable z assigned register $t9
+# variable w assigned register $v1
+# variable v assigned register $t3
+# variable $temp1 assigned register $t4
+# variable $temp0 assigned register $t4
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+move, $t7, $a0, # store to x
+move, $t8, $a1, # store to y
+move, $t9, $a2, # store to z
+move, $v1, $a3, # store to w
+lw, $t3, 8($sp), # parameter 4
+# spilling for jal
+sw, $t3, 0($sp), # store to v
+move, $a0, $t7, # move of x to fn arg/ret
+move, $a1, $t8, # move of y to fn arg/ret
+move, $a2, $t9, # move of z to fn arg/ret
+move, $a3, $v1, # move of w to fn arg/ret
+sw, $t3, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+lw, $t3, 0($sp), # load from v
+move, $t4, $v0, # store to $temp0
+# spilling for jal
+move, $a0, $t3, # move of v to fn arg/ret
+move, $a1, $v1, # move of w to fn arg/ret
+move, $a2, $t9, # move of z to fn arg/ret
+move, $a3, $t8, # move of y to fn arg/ret
+sw, $t7, -8($sp), # argument 4
+sw, $t4, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $t4, $v0, # store to $temp1
+add, $t4, $t4, $t7
+move, $v0, $t4, # move of $temp1 to fn arg/ret
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+# enter main
+# variable $temp1 assigned register $t3
+# variable $temp0 assigned register $t3
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# spilling for jal
+li, $a0, 1
+li, $a1, 2
+li, $a2, 3
+li, $a3, 4
+li, $t0, 5
+sw, $t0, -4($sp), # argument 4
+addiu, $sp, $sp, -4
+jal, twice
+addiu, $sp, $sp, 4
+# unspilling
+move, $t3, $v0, # store to $temp0
+move, $a0, $t3, # move of $temp0 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+li, $a0, 6
+li, $a1, 5
+li, $a2, 4
+li, $a3, 3
+li, $t0, 2
+sw, $t0, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+# unspilling
+move, $t3, $v0, # store to $temp1
+move, $a0, $t3, # move of $temp1 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
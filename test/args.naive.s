@@ -0,0 +1,126 @@
+.text
+weigh:
+addiu, $sp, $sp, -28
+sw, $a0, 0($sp), # store to a
+sw, $a1, 4($sp), # store to b
+sw, $a2, 8($sp), # store to c
+sw, $a3, 12($sp), # store to d
+lw, $t0, 28($sp), # parameter 4
+sw, $t0, 16($sp), # store to e
+lw, $t0, 32($sp), # parameter 5
+sw, $t0, 20($sp), # store to f
+lw, $t0, 4($sp), # load from b
+mul, $t2, $t0, 2
+sw, $t2, 4($sp), # store to $temp0
+lw, $t0, 0($sp), # load from a
+lw, $t1, 4($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 0($sp), # store to $temp1
+lw, $t0, 8($sp), # load from c
+mul, $t2, $t0, 3
+sw, $t2, 4($sp), # store to $temp2
+lw, $t0, 0($sp), # load from $temp1
+lw, $t1, 4($sp), # load from $temp2
+add, $t2, $t0, $t1
+sw, $t2, 0($sp), # store to $temp3
+lw, $t0, 12($sp), # load from d
+mul, $t2, $t0, 4
+sw, $t2, 4($sp), # store to $temp4
+lw, $t0, 0($sp), # load from $temp3
+lw, $t1, 4($sp), # load from $temp4
+add, $t2, $t0, $t1
+sw, $t2, 0($sp), # store to $temp5
+lw, $t0, 16($sp), # load from e
+mul, $t2, $t0, 5
+sw, $t2, 4($sp), # store to $temp6
+lw, $t0, 0($sp), # load from $temp5
+lw, $t1, 4($sp), # load from $temp6
+add, $t2, $t0, $t1
+sw, $t2, 0($sp), # store to $temp7
+lw, $t0, 20($sp), # load from f
+mul, $t2, $t0, 6
+sw, $t2, 4($sp), # store to $temp8
+lw, $t0, 0($sp), # load from $temp7
+lw, $t1, 4($sp), # load from $temp8
+add, $t2, $t0, $t1
+sw, $t2, 0($sp), # store to $temp9
+lw, $v0, 0($sp), # load from $temp9
+addiu, $sp, $sp, 28
+jr, $ra
+twice:
+addiu, $sp, $sp, -28
+sw, $ra, 24($sp)
+sw, $a0, 0($sp), # store to x
+sw, $a1, 4($sp), # store to y
+sw, $a2, 8($sp), # store to z
+sw, $a3, 12($sp), # store to w
+lw, $t0, 28($sp), # parameter 4
+sw, $t0, 16($sp), # store to v
+lw, $a0, 0($sp), # load from x
+lw, $a1, 4($sp), # load from y
+lw, $a2, 8($sp), # load from z
+lw, $a3, 12($sp), # load from w
+lw, $t0, 16($sp), # load from v
+sw, $t0, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+sw, $v0, 20($sp), # store to $temp0
+lw, $a0, 16($sp), # load from v
+lw, $a1, 12($sp), # load from w
+lw, $a2, 8($sp), # load from z
+lw, $a3, 4($sp), # load from y
+lw, $t0, 0($sp), # load from x
+sw, $t0, -8($sp), # argument 4
+lw, $t0, 20($sp), # load from $temp0
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+sw, $v0, 4($sp), # store to $temp1
+lw, $t0, 4($sp), # load from $temp1
+lw, $t1, 0($sp), # load from x
+add, $t2, $t0, $t1
+sw, $t2, 4($sp), # store to $temp1
+lw, $v0, 4($sp), # load from $temp1
+lw, $ra, 24($sp)
+addiu, $sp, $sp, 28
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+li, $t0, 3
+sw, $t0, 0($sp), # store to i
+li, $a0, 1
+li, $a1, 2
+lw, $a2, 0($sp), # load from i
+li, $a3, 4
+li, $t0, 5
+sw, $t0, -4($sp), # argument 4
+addiu, $sp, $sp, -4
+jal, twice
+addiu, $sp, $sp, 4
+sw, $v0, 0($sp), # store to $temp0
+lw, $a0, 0($sp), # load from $temp0
+li, $v0, 1
+syscall, # printi
+li, $a0, 6
+li, $a1, 5
+li, $a2, 4
+li, $a3, 3
+li, $t0, 2
+sw, $t0, -8($sp), # argument 4
+li, $t0, 1
+sw, $t0, -4($sp), # argument 5
+addiu, $sp, $sp, -8
+jal, weigh
+addiu, $sp, $sp, 8
+sw, $v0, 0($sp), # store to $temp1
+lw, $a0, 0($sp), # load from $temp1
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
@@ -0,0 +1,12 @@
+#!/bin/bash
+
+set -e
+
+./phase2 test/args.ir $1
+
+diff out.s test/args.$1.s
+
+spim -f out.s > tmp
+
+diff tmp test/args.out
+
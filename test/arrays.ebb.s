@@ -0,0 +1,251 @@
+.data
+Y: .space 40
+A: .space 40
+B: .space 40
+F: .space 16
+_float0: .float 1.5
+_float1: .float 1.0
+.text
+wrap:
+addiu, $sp, $sp, -16
+# start of extended block - loading into registers
+# variable w is assigned register $t3
+li, $t3, 0
+li, $t0, 0
+sw, $t0, 4($sp), # store to k
+wrap_loop_pre:
+sll, $t1, $t3, 2
+la, $t0, Y
+addu, $t2, $t0, $t1
+sw, $t2, 8($sp), # store to $ptr.20
+# begin spilling
+sw, $t3, 0($sp), # store to w
+# end of block
+wrap_loop:
+# start of extended block - loading into registers
+# variable w is assigned register $t4
+lw, $t4, 0($sp), # load from w
+# variable k is assigned register $t3
+lw, $t3, 4($sp), # load from k
+# variable $ptr.20 is assigned register $t5
+lw, $t5, 8($sp), # load from $ptr.20
+# begin spilling
+# end of block
+bge, $t4, 2147483647, wrap_far # if (w >= 2147483647) goto wrap_far
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 4($sp), # store to k
+# end of block
+beq, $t3, 3, wrap_far # if (k == 3) goto wrap_far
+# begin spilling
+# end of block
+bne, $t3, 100, wrap_next # if (k != 100) goto wrap_next
+li, $t2, 5
+sw, $t2, 0($t5)
+# begin spilling
+# end of block
+wrap_next:
+# start of extended block - loading into registers
+# variable w is assigned register $t4
+lw, $t4, 0($sp), # load from w
+# variable $ptr.20 is assigned register $t3
+lw, $t3, 8($sp), # load from $ptr.20
+add, $t4, $t4, 1
+addu, $t3, $t3, 4
+# begin spilling
+sw, $t4, 0($sp), # store to w
+sw, $t3, 8($sp), # store to $ptr.20
+# end of block
+j, wrap_loop
+wrap_far:
+# start of extended block - loading into registers
+# variable w is assigned register $t3
+li, $t3, 500000000
+wrap_high_pre:
+sll, $t1, $t3, 2
+la, $t0, Y
+addu, $t2, $t0, $t1
+sw, $t2, 8($sp), # store to $ptr.23
+# begin spilling
+sw, $t3, 0($sp), # store to w
+# end of block
+wrap_high:
+# start of extended block - loading into registers
+# variable w is assigned register $t3
+lw, $t3, 0($sp), # load from w
+# variable k is assigned register $t5
+lw, $t5, 4($sp), # load from k
+# variable $ptr.23 is assigned register $t4
+lw, $t4, 8($sp), # load from $ptr.23
+bge, $t3, 500000003, wrap_done # if (w >= 500000003) goto wrap_done
+# begin spilling
+# end of block
+bne, $t3, 7, wrap_skip # if (w != 7) goto wrap_skip
+li, $t2, 5
+sw, $t2, 0($t4)
+# begin spilling
+# end of block
+wrap_skip:
+# start of extended block - loading into registers
+# variable w is assigned register $t4
+lw, $t4, 0($sp), # load from w
+# variable $ptr.23 is assigned register $t3
+lw, $t3, 8($sp), # load from $ptr.23
+add, $t4, $t4, 1
+addu, $t3, $t3, 4
+# begin spilling
+sw, $t4, 0($sp), # store to w
+sw, $t3, 8($sp), # store to $ptr.23
+# end of block
+j, wrap_high
+wrap_done:
+move, $v0, $t5, # move of k to fn arg/ret
+addiu, $sp, $sp, 16
+jr, $ra
+main:
+# start of extended block - loading into registers
+# variable i is assigned register $t3
+li, $t3, 0
+fill_pre:
+addiu, $sp, $sp, -28
+sw, $ra, 24($sp)
+sll, $t1, $t3, 2
+la, $t0, A
+addu, $t2, $t0, $t1
+sw, $t2, 4($sp), # store to $ptr.30
+sll, $t1, $t3, 2
+la, $t0, B
+addu, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to $ptr.31
+# begin spilling
+sw, $t3, 0($sp), # store to i
+# end of block
+fill:
+# start of extended block - loading into registers
+# variable i is assigned register $t3
+lw, $t3, 0($sp), # load from i
+# variable j is assigned register $t7
+# variable t is assigned register $t6
+# variable $ptr.30 is assigned register $t5
+lw, $t5, 4($sp), # load from $ptr.30
+# variable $ptr.31 is assigned register $t4
+lw, $t4, 12($sp), # load from $ptr.31
+bge, $t3, 10, filled # if (i >= 10) goto filled
+sw, $t3, 0($t5)
+mul, $t6, $t3, $t3
+sw, $t6, 0($t4)
+add, $t3, $t3, 1
+addu, $t5, $t5, 4
+addu, $t4, $t4, 4
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t5, 4($sp), # store to $ptr.30
+sw, $t4, 12($sp), # store to $ptr.31
+# end of block
+j, fill
+filled:
+li, $t0, 0
+sw, $t0, 4($sp), # store to s
+li, $t7, 9
+down_pre:
+sll, $t1, $t7, 2
+la, $t0, A
+addu, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to $ptr.33
+sll, $t1, $t7, 2
+la, $t0, B
+addu, $t2, $t0, $t1
+sw, $t2, 16($sp), # store to $ptr.34
+la, $t0, A
+sw, $t0, 20($sp), # store to $end.36
+# begin spilling
+# end of block
+down:
+# start of extended block - loading into registers
+# variable j is assigned register $t9
+# variable s is assigned register $t7
+lw, $t7, 4($sp), # load from s
+# variable t is assigned register $t5
+# variable u is assigned register $t8
+# variable $ptr.33 is assigned register $t3
+lw, $t3, 12($sp), # load from $ptr.33
+# variable $ptr.34 is assigned register $t4
+lw, $t4, 16($sp), # load from $ptr.34
+# variable $end.36 is assigned register $t6
+lw, $t6, 20($sp), # load from $end.36
+blt, $t3, $t6, summed # if ($ptr.33 < $end.36) goto summed
+lw, $t1, 0($t3)
+move, $t5, $t1
+lw, $t1, 0($t4)
+move, $t8, $t1
+add, $t5, $t5, $t8
+add, $t7, $t7, $t5
+addu, $t3, $t3, -4
+addu, $t4, $t4, -4
+# begin spilling
+sw, $t7, 4($sp), # store to s
+sw, $t3, 12($sp), # store to $ptr.33
+sw, $t4, 16($sp), # store to $ptr.34
+# end of block
+j, down
+summed:
+move, $a0, $t7, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+li, $t9, 0
+l.s, $f0, _float0
+s.s, $f0, 4($sp), # store to y
+floats_pre:
+sll, $t1, $t9, 2
+la, $t0, F
+addu, $t2, $t0, $t1
+sw, $t2, 8($sp), # store to $ptr.38
+# begin spilling
+sw, $t9, 0($sp), # store to j
+# end of block
+floats:
+# start of extended block - loading into registers
+# variable j is assigned register $t3
+lw, $t3, 0($sp), # load from j
+# variable t is assigned register $t5
+# variable x is assigned register $f8
+# variable y is assigned register $f6
+l.s, $f6, 4($sp), # load from y
+# variable $ptr.38 is assigned register $t4
+lw, $t4, 8($sp), # load from $ptr.38
+bge, $t3, 4, floated # if (j >= 4) goto floated
+s.s, $f6, 0($t4)
+l.s, $f2, _float1
+add.s, $f6, $f6, $f2
+add, $t3, $t3, 2
+addu, $t4, $t4, 8
+# begin spilling
+sw, $t3, 0($sp), # store to j
+s.s, $f6, 4($sp), # store to y
+sw, $t4, 8($sp), # store to $ptr.38
+# end of block
+j, floats
+floated:
+l.s, $f0, F+8
+mov.s, $f8, $f0
+mov.s, $f12, $f8, # move of x to fn arg/ret
+li, $v0, 2
+syscall, # printf
+lw, $t1, A+28
+move, $t5, $t1
+move, $a0, $t5, # move of t to fn arg/ret
+li, $v0, 1
+syscall, # printi
+move, $a0, $t3, # move of j to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+jal, wrap
+# unspilling
+move, $t5, $v0
+move, $a0, $t5, # move of t to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 24($sp)
+addiu, $sp, $sp, 28
+jr, $ra
@@ -0,0 +1,143 @@
+.data
+Y: .space 40
+A: .space 40
+B: .space 40
+F: .space 16
+_float0: .float 1.5
+_float1: .float 1.0
+.text
+wrap:
+# enter wrap
+# variable w assigned register $t3
+# variable k assigned register $t4
+# variable $ptr.20 assigned register $t5
+# variable $ptr.23 assigned register $t5
+# variable $w.25 assigned register $t3
+li, $t3, 0, # store to w
+li, $t4, 0, # store to k
+wrap_loop_pre:
+sll, $t1, $t3, 2
+la, $t0, Y
+addu, $t5, $t0, $t1
+wrap_loop:
+bge, $t3, 2147483647, wrap_far # if (w >= 2147483647) goto wrap_far
+add, $t4, $t4, 1
+beq, $t4, 3, wrap_far # if (k == 3) goto wrap_far
+bne, $t4, 100, wrap_next # if (k != 100) goto wrap_next
+li, $t2, 5
+sw, $t2, 0($t5)
+wrap_next:
+add, $t3, $t3, 1
+addu, $t5, $t5, 4
+j, wrap_loop
+wrap_far:
+li, $t3, 500000000, # store to $w.25
+wrap_high_pre:
+sll, $t1, $t3, 2
+la, $t0, Y
+addu, $t5, $t0, $t1
+wrap_high:
+bge, $t3, 500000003, wrap_done # if ($w.25 >= 500000003) goto wrap_done
+bne, $t3, 7, wrap_skip # if ($w.25 != 7) goto wrap_skip
+li, $t2, 5
+sw, $t2, 0($t5)
+wrap_skip:
+add, $t3, $t3, 1
+addu, $t5, $t5, 4
+j, wrap_high
+wrap_done:
+move, $v0, $t4, # move of k to fn arg/ret
+jr, $ra
+main:
+# enter main
+# variable $t.44 goes straight to $a0
+# variable $t.45 goes straight to $a0
+# variable i assigned register $t3
+# variable j assigned register $t4
+# variable s assigned register $t3
+# variable t assigned register $t6
+# variable u assigned register $t7
+# variable x assigned register $f6
+# variable y assigned register $f6
+# variable $ptr.30 assigned register $t4
+# variable $ptr.31 assigned register $t5
+# variable $ptr.33 assigned register $t4
+# variable $ptr.34 assigned register $t5
+# variable $end.36 assigned register $t6
+# variable $ptr.38 assigned register $t4
+# variable $t.41 assigned register $t8
+# variable $t.42 assigned register $t7
+# variable $j.43 assigned register $t3
+li, $t3, 0, # store to i
+fill_pre:
+sll, $t1, $t3, 2
+la, $t0, A
+addu, $t4, $t0, $t1
+sll, $t1, $t3, 2
+la, $t0, B
+addu, $t5, $t0, $t1
+fill:
+bge, $t3, 10, filled # if (i >= 10) goto filled
+sw, $t3, 0($t4)
+mul, $t6, $t3, $t3
+sw, $t6, 0($t5)
+add, $t3, $t3, 1
+addu, $t4, $t4, 4
+addu, $t5, $t5, 4
+j, fill
+filled:
+li, $t3, 0, # store to s
+li, $t4, 9, # store to j
+down_pre:
+la, $t4, A+36
+la, $t5, B+36
+la, $t6, A
+down:
+blt, $t4, $t6, summed # if ($ptr.33 < $end.36) goto summed
+lw, $t8, 0($t4)
+lw, $t7, 0($t5)
+add, $t7, $t8, $t7
+add, $t3, $t3, $t7
+addu, $t4, $t4, -4
+addu, $t5, $t5, -4
+j, down
+summed:
+move, $a0, $t3, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+li, $t3, 0, # store to $j.43
+l.s, $f6, _float0, # store to y
+floats_pre:
+sll, $t1, $t3, 2
+la, $t0, F
+addu, $t4, $t0, $t1
+floats:
+bge, $t3, 4, floated # if ($j.43 >= 4) goto floated
+s.s, $f6, 0($t4)
+l.s, $f2, _float1
+add.s, $f6, $f6, $f2
+add, $t3, $t3, 2
+addu, $t4, $t4, 8
+j, floats
+floated:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+l.s, $f6, F+8
+mov.s, $f12, $f6, # move of x to fn arg/ret
+li, $v0, 2
+syscall, # printf
+lw, $a0, A+28
+li, $v0, 1
+syscall, # printi
+move, $a0, $t3, # move of $j.43 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+jal, wrap
+# unspilling
+move, $a0, $v0, # store to $t.45
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
@@ -0,0 +1,271 @@
+.data
+Y: .space 40
+A: .space 40
+B: .space 40
+F: .space 16
+_float0: .float 1.5
+_float1: .float 1.0
+.text
+wrap:
+addiu, $sp, $sp, -16
+# start of block
+li, $t3, 0
+li, $t4, 0
+# begin spilling
+sw, $t3, 0($sp), # store to w
+sw, $t4, 4($sp), # store to k
+# end of block
+wrap_loop_pre:
+# start of block
+lw, $t3, 0($sp), # load from w
+sll, $t1, $t3, 2
+la, $t0, Y
+addu, $t4, $t0, $t1
+# begin spilling
+sw, $t4, 8($sp), # store to $ptr.20
+# end of block
+wrap_loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from w
+bge, $t3, 2147483647, wrap_far # if (w >= 2147483647) goto wrap_far
+# start of block
+lw, $t3, 4($sp), # load from k
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 4($sp), # store to k
+# end of block
+beq, $t3, 3, wrap_far # if (k == 3) goto wrap_far
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 4($sp), # load from k
+bne, $t3, 100, wrap_next # if (k != 100) goto wrap_next
+# start of block
+li, $t2, 5
+lw, $t3, 8($sp), # load from $ptr.20
+sw, $t2, 0($t3)
+# begin spilling
+# end of block
+wrap_next:
+# start of block
+lw, $t3, 0($sp), # load from w
+add, $t3, $t3, 1
+lw, $t4, 8($sp), # load from $ptr.20
+addu, $t4, $t4, 4
+# begin spilling
+sw, $t3, 0($sp), # store to w
+sw, $t4, 8($sp), # store to $ptr.20
+# end of block
+j, wrap_loop
+wrap_far:
+# start of block
+li, $t3, 500000000
+# begin spilling
+sw, $t3, 0($sp), # store to w
+# end of block
+wrap_high_pre:
+# start of block
+lw, $t3, 0($sp), # load from w
+sll, $t1, $t3, 2
+la, $t0, Y
+addu, $t4, $t0, $t1
+# begin spilling
+sw, $t4, 8($sp), # store to $ptr.23
+# end of block
+wrap_high:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from w
+bge, $t3, 500000003, wrap_done # if (w >= 500000003) goto wrap_done
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from w
+bne, $t3, 7, wrap_skip # if (w != 7) goto wrap_skip
+# start of block
+li, $t2, 5
+lw, $t3, 8($sp), # load from $ptr.23
+sw, $t2, 0($t3)
+# begin spilling
+# end of block
+wrap_skip:
+# start of block
+lw, $t3, 0($sp), # load from w
+add, $t3, $t3, 1
+lw, $t4, 8($sp), # load from $ptr.23
+addu, $t4, $t4, 4
+# begin spilling
+sw, $t3, 0($sp), # store to w
+sw, $t4, 8($sp), # store to $ptr.23
+# end of block
+j, wrap_high
+wrap_done:
+# start of block
+# begin spilling
+# end of block
+lw, $v0, 4($sp), # load from k
+addiu, $sp, $sp, 16
+jr, $ra
+main:
+addiu, $sp, $sp, -28
+sw, $ra, 24($sp)
+# start of block
+li, $t3, 0
+# begin spilling
+sw, $t3, 0($sp), # store to i
+# end of block
+fill_pre:
+# start of block
+lw, $t3, 0($sp), # load from i
+sll, $t1, $t3, 2
+la, $t0, A
+addu, $t4, $t0, $t1
+sll, $t1, $t3, 2
+la, $t0, B
+addu, $t5, $t0, $t1
+# begin spilling
+sw, $t4, 4($sp), # store to $ptr.30
+sw, $t5, 12($sp), # store to $ptr.31
+# end of block
+fill:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from i
+bge, $t3, 10, filled # if (i >= 10) goto filled
+# start of block
+lw, $t3, 0($sp), # load from i
+lw, $t4, 4($sp), # load from $ptr.30
+sw, $t3, 0($t4)
+mul, $t5, $t3, $t3
+lw, $t6, 12($sp), # load from $ptr.31
+sw, $t5, 0($t6)
+add, $t3, $t3, 1
+addu, $t4, $t4, 4
+addu, $t6, $t6, 4
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t4, 4($sp), # store to $ptr.30
+sw, $t6, 12($sp), # store to $ptr.31
+# end of block
+j, fill
+filled:
+# start of block
+li, $t3, 0
+li, $t4, 9
+# begin spilling
+sw, $t3, 4($sp), # store to s
+sw, $t4, 0($sp), # store to j
+# end of block
+down_pre:
+# start of block
+lw, $t3, 0($sp), # load from j
+sll, $t1, $t3, 2
+la, $t0, A
+addu, $t4, $t0, $t1
+sll, $t1, $t3, 2
+la, $t0, B
+addu, $t5, $t0, $t1
+la, $t0, A
+move, $t6, $t0
+# begin spilling
+sw, $t4, 12($sp), # store to $ptr.33
+sw, $t5, 16($sp), # store to $ptr.34
+sw, $t6, 20($sp), # store to $end.36
+# end of block
+down:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 12($sp), # load from $ptr.33
+lw, $t4, 20($sp), # load from $end.36
+blt, $t3, $t4, summed # if ($ptr.33 < $end.36) goto summed
+# start of block
+lw, $t3, 12($sp), # load from $ptr.33
+lw, $t1, 0($t3)
+move, $t4, $t1
+lw, $t5, 16($sp), # load from $ptr.34
+lw, $t1, 0($t5)
+move, $t6, $t1
+add, $t4, $t4, $t6
+lw, $t7, 4($sp), # load from s
+add, $t7, $t7, $t4
+addu, $t3, $t3, -4
+addu, $t5, $t5, -4
+# begin spilling
+sw, $t3, 12($sp), # store to $ptr.33
+sw, $t5, 16($sp), # store to $ptr.34
+sw, $t7, 4($sp), # store to s
+# end of block
+j, down
+summed:
+# start of block
+lw, $a0, 4($sp), # load from s
+li, $v0, 1
+syscall, # printi
+li, $t3, 0
+l.s, $f6, _float0
+# begin spilling
+sw, $t3, 0($sp), # store to j
+s.s, $f6, 4($sp), # store to y
+# end of block
+floats_pre:
+# start of block
+lw, $t3, 0($sp), # load from j
+sll, $t1, $t3, 2
+la, $t0, F
+addu, $t4, $t0, $t1
+# begin spilling
+sw, $t4, 8($sp), # store to $ptr.38
+# end of block
+floats:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from j
+bge, $t3, 4, floated # if (j >= 4) goto floated
+# start of block
+l.s, $f6, 4($sp), # load from y
+lw, $t3, 8($sp), # load from $ptr.38
+s.s, $f6, 0($t3)
+l.s, $f2, _float1
+add.s, $f6, $f6, $f2
+lw, $t4, 0($sp), # load from j
+add, $t4, $t4, 2
+addu, $t3, $t3, 8
+# begin spilling
+sw, $t3, 8($sp), # store to $ptr.38
+sw, $t4, 0($sp), # store to j
+s.s, $f6, 4($sp), # store to y
+# end of block
+j, floats
+floated:
+# start of block
+l.s, $f0, F+8
+mov.s, $f6, $f0
+mov.s, $f12, $f6, # move of x to fn arg/ret
+li, $v0, 2
+syscall, # printf
+lw, $t1, A+28
+move, $t3, $t1
+move, $a0, $t3, # move of t to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $a0, 0($sp), # load from j
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+jal, wrap
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of t to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+lw, $ra, 24($sp)
+addiu, $sp, $sp, 28
+jr, $ra
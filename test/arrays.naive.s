@@ -0,0 +1,211 @@
+.data
+Y: .space 40
+A: .space 40
+B: .space 40
+F: .space 16
+_float0: .float 1.5
+_float1: .float 1.0
+.text
+wrap:
+addiu, $sp, $sp, -20
+li, $t0, 2147483647
+sw, $t0, 8($sp), # store to lim
+li, $t0, 0
+sw, $t0, 0($sp), # store to w
+li, $t0, 0
+sw, $t0, 4($sp), # store to k
+wrap_loop_pre:
+lw, $t1, 0($sp), # load from w
+sll, $t1, $t1, 2
+la, $t0, Y
+addu, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to $ptr.20
+wrap_loop:
+lw, $t0, 0($sp), # load from w
+lw, $t1, 8($sp), # load from lim
+bge, $t0, $t1, wrap_far # if (w >= lim) goto wrap_far
+lw, $t0, 4($sp), # load from k
+add, $t2, $t0, 1
+sw, $t2, 4($sp), # store to k
+lw, $t0, 4($sp), # load from k
+beq, $t0, 3, wrap_far # if (k == 3) goto wrap_far
+lw, $t0, 4($sp), # load from k
+bne, $t0, 100, wrap_next # if (k != 100) goto wrap_next
+li, $t2, 5
+lw, $t0, 12($sp), # load from $ptr.20
+sw, $t2, 0($t0)
+wrap_next:
+lw, $t0, 0($sp), # load from w
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to w
+lw, $t0, 12($sp), # load from $ptr.20
+addu, $t2, $t0, 4
+sw, $t2, 12($sp), # store to $ptr.20
+j, wrap_loop
+wrap_far:
+li, $t0, 500000000
+sw, $t0, 0($sp), # store to w
+wrap_high_pre:
+lw, $t1, 0($sp), # load from w
+sll, $t1, $t1, 2
+la, $t0, Y
+addu, $t2, $t0, $t1
+sw, $t2, 8($sp), # store to $ptr.23
+wrap_high:
+lw, $t0, 0($sp), # load from w
+bge, $t0, 500000003, wrap_done # if (w >= 500000003) goto wrap_done
+lw, $t0, 0($sp), # load from w
+bne, $t0, 7, wrap_skip # if (w != 7) goto wrap_skip
+li, $t2, 5
+lw, $t0, 8($sp), # load from $ptr.23
+sw, $t2, 0($t0)
+wrap_skip:
+lw, $t0, 0($sp), # load from w
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to w
+lw, $t0, 8($sp), # load from $ptr.23
+addu, $t2, $t0, 4
+sw, $t2, 8($sp), # store to $ptr.23
+j, wrap_high
+wrap_done:
+lw, $v0, 4($sp), # load from k
+addiu, $sp, $sp, 20
+jr, $ra
+main:
+addiu, $sp, $sp, -28
+sw, $ra, 24($sp)
+li, $t0, 10
+sw, $t0, 4($sp), # store to n
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+fill_pre:
+lw, $t1, 0($sp), # load from i
+sll, $t1, $t1, 2
+la, $t0, A
+addu, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to $ptr.30
+lw, $t1, 0($sp), # load from i
+sll, $t1, $t1, 2
+la, $t0, B
+addu, $t2, $t0, $t1
+sw, $t2, 16($sp), # store to $ptr.31
+fill:
+lw, $t0, 0($sp), # load from i
+lw, $t1, 4($sp), # load from n
+bge, $t0, $t1, filled # if (i >= n) goto filled
+lw, $t2, 0($sp), # load from i
+lw, $t0, 12($sp), # load from $ptr.30
+sw, $t2, 0($t0)
+lw, $t0, 0($sp), # load from i
+lw, $t1, 0($sp), # load from i
+mul, $t2, $t0, $t1
+sw, $t2, 8($sp), # store to t
+lw, $t2, 8($sp), # load from t
+lw, $t0, 16($sp), # load from $ptr.31
+sw, $t2, 0($t0)
+lw, $t0, 0($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to i
+lw, $t0, 12($sp), # load from $ptr.30
+addu, $t2, $t0, 4
+sw, $t2, 12($sp), # store to $ptr.30
+lw, $t0, 16($sp), # load from $ptr.31
+addu, $t2, $t0, 4
+sw, $t2, 16($sp), # store to $ptr.31
+j, fill
+filled:
+li, $t0, 0
+sw, $t0, 4($sp), # store to s
+li, $t0, 9
+sw, $t0, 0($sp), # store to j
+down_pre:
+lw, $t1, 0($sp), # load from j
+sll, $t1, $t1, 2
+la, $t0, A
+addu, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to $ptr.33
+lw, $t1, 0($sp), # load from j
+sll, $t1, $t1, 2
+la, $t0, B
+addu, $t2, $t0, $t1
+sw, $t2, 16($sp), # store to $ptr.34
+la, $t0, A
+sw, $t0, 20($sp), # store to $end.36
+down:
+lw, $t0, 12($sp), # load from $ptr.33
+lw, $t1, 20($sp), # load from $end.36
+blt, $t0, $t1, summed # if ($ptr.33 < $end.36) goto summed
+lw, $t0, 12($sp), # load from $ptr.33
+lw, $t1, 0($t0)
+sw, $t1, 8($sp), # store to t
+lw, $t0, 16($sp), # load from $ptr.34
+lw, $t1, 0($t0)
+sw, $t1, 0($sp), # store to u
+lw, $t0, 8($sp), # load from t
+lw, $t1, 0($sp), # load from u
+add, $t2, $t0, $t1
+sw, $t2, 8($sp), # store to t
+lw, $t0, 4($sp), # load from s
+lw, $t1, 8($sp), # load from t
+add, $t2, $t0, $t1
+sw, $t2, 4($sp), # store to s
+lw, $t0, 12($sp), # load from $ptr.33
+addu, $t2, $t0, -4
+sw, $t2, 12($sp), # store to $ptr.33
+lw, $t0, 16($sp), # load from $ptr.34
+addu, $t2, $t0, -4
+sw, $t2, 16($sp), # store to $ptr.34
+j, down
+summed:
+lw, $a0, 4($sp), # load from s
+li, $v0, 1
+syscall, # printi
+li, $t0, 0
+sw, $t0, 0($sp), # store to j
+l.s, $f0, _float0
+s.s, $f0, 4($sp), # store to y
+floats_pre:
+lw, $t1, 0($sp), # load from j
+sll, $t1, $t1, 2
+la, $t0, F
+addu, $t2, $t0, $t1
+sw, $t2, 8($sp), # store to $ptr.38
+floats:
+lw, $t0, 0($sp), # load from j
+bge, $t0, 4, floated # if (j >= 4) goto floated
+l.s, $f0, 4($sp), # load from y
+lw, $t0, 8($sp), # load from $ptr.38
+s.s, $f0, 0($t0)
+l.s, $f0, 4($sp), # load from y
+l.s, $f2, _float1
+add.s, $f4, $f0, $f2
+s.s, $f4, 4($sp), # store to y
+lw, $t0, 0($sp), # load from j
+add, $t2, $t0, 2
+sw, $t2, 0($sp), # store to j
+lw, $t0, 8($sp), # load from $ptr.38
+addu, $t2, $t0, 8
+sw, $t2, 8($sp), # store to $ptr.38
+j, floats
+floated:
+l.s, $f0, F+8
+s.s, $f0, 4($sp), # store to x
+l.s, $f12, 4($sp), # load from x
+li, $v0, 2
+syscall, # printf
+lw, $t1, A+28
+sw, $t1, 8($sp), # store to t
+lw, $a0, 8($sp), # load from t
+li, $v0, 1
+syscall, # printi
+lw, $a0, 0($sp), # load from j
+li, $v0, 1
+syscall, # printi
+jal, wrap
+sw, $v0, 8($sp), # store to t
+lw, $a0, 8($sp), # load from t
+li, $v0, 1
+syscall, # printi
+lw, $ra, 24($sp)
+addiu, $sp, $sp, 28
+jr, $ra
@@ -0,0 +1,20 @@
+.text
+foo:
+# start of extended block - loading into registers
+li, $v0, 42
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of extended block - loading into registers
+# variable $t0 is assigned register $t3
+# spilling for jal
+jal, foo
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of $t0 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
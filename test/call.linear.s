@@ -0,0 +1,20 @@
+.text
+foo:
+# enter foo
+li, $v0, 42
+jr, $ra
+main:
+# enter main
+# variable $t0 assigned register $t3
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+# spilling for jal
+jal, foo
+# unspilling
+move, $t3, $v0, # store to $t0
+move, $a0, $t3, # move of $t0 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
@@ -1,10 +1,6 @@
 .text
 foo:
-addiu, $sp, $sp, -4
-sw, $ra, 0($sp)
 li, $v0, 42
-lw, $ra, 0($sp)
-addiu, $sp, $sp, 4
 jr, $ra
 main:
 addiu, $sp, $sp, -8
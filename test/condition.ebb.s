@@ -0,0 +1,26 @@
+.text
+main:
+addiu, $sp, $sp, -8
+# start of extended block - loading into registers
+# variable i is assigned register $t3
+li, $t3, 5
+ble, $t3, 42, label0 # if (i <= 42) goto label0
+li, $t0, 0
+sw, $t0, 0($sp), # store to j
+# begin spilling
+# end of block
+j, label1
+label0:
+li, $t0, 1
+sw, $t0, 0($sp), # store to j
+# begin spilling
+# end of block
+label1:
+# start of extended block - loading into registers
+# variable j is assigned register $t3
+lw, $t3, 0($sp), # load from j
+move, $a0, $t3, # move of j to fn arg/ret
+li, $v0, 1
+syscall, # printi
+addiu, $sp, $sp, 8
+jr, $ra
@@ -1,39 +1,29 @@
 .text
 main:
-addiu, $sp, $sp, -16
-sw, $ra, 12($sp)
-# start of block - loading into registers
-# variable i is assigned register $s0
-lw, $s0, 4($sp), # load from i
-li, $s0, 5
+addiu, $sp, $sp, -8
+# start of block
+li, $t3, 5
 # begin spilling
 # end of block
-ble, $s0, 42, label0 # if (i <= 42) goto label0
-# start of block - loading into registers
-li, $t0, 0
-sw, $t0, 8($sp), # store to j
+ble, $t3, 42, label0 # if (i <= 42) goto label0
+# start of block
+li, $t3, 0
 # begin spilling
+sw, $t3, 0($sp), # store to j
 # end of block
 j, label1
 label0:
-# start of block - loading into registers
-li, $t0, 1
-sw, $t0, 8($sp), # store to j
+# start of block
+li, $t3, 1
 # begin spilling
+sw, $t3, 0($sp), # store to j
 # end of block
-j, label1
 label1:
-# start of block - loading into registers
-# variable j is assigned register $s0
-lw, $s0, 8($sp), # load from j
-# begin spilling
-# end of block
-move, $a0, $s0, # move of j to fn arg/ret
+# start of block
+lw, $a0, 0($sp), # load from j
 li, $v0, 1
 syscall, # printi
-# start of block - loading into registers
 # begin spilling
 # end of block
-lw, $ra, 12($sp)
-addiu, $sp, $sp, 16
+addiu, $sp, $sp, 8
 jr, $ra
@@ -0,0 +1,16 @@
+.text
+main:
+# enter main
+# variable i assigned register $t3
+# variable j assigned register $t3
+li, $t3, 5, # store to i
+ble, $t3, 42, label0 # if (i <= 42) goto label0
+li, $t3, 0, # store to j
+j, label1
+label0:
+li, $t3, 1, # store to j
+label1:
+move, $a0, $t3, # move of j to fn arg/ret
+li, $v0, 1
+syscall, # printi
+jr, $ra
@@ -1,60 +1,79 @@
 .data
-r_st_1_0: .word 1
+r_st_1_0: .word 0
 .text
 fact_st_1_0:
-addiu $sp, $sp, -72
-sw $ra, 16($sp)
-li $t8, 0
-move $t6, $a0
-li $s3, 1
-li $s2, 1
-bne $t6, $s3, cond_0_stz_stf_fact_2_0
-j cond_1_after_stf_fact_2_0
+addiu, $sp, $sp, -16
+sw, $ra, 12($sp)
+sw, $a0, 8($sp), # store to n_stf_fact_2_0
+# start of extended block - loading into registers
+# variable $temp1 is assigned register $t4
+# variable n_stf_fact_2_0 is assigned register $t3
+lw, $t3, 8($sp), # load from n_stf_fact_2_0
+move, $t4, $t3
+li, $t0, 1
+sw, $t0, 4($sp), # store to $temp3
+bne, $t4, 1, cond_0_stz_stf_fact_2_0 # if ($temp1 != 1) goto cond_0_stz_stf_fact_2_0
+# begin spilling
+# end of block
+j, cond_1_after_stf_fact_2_0
 cond_0_stz_stf_fact_2_0:
-li $s2, 0
+li, $t0, 0
+sw, $t0, 4($sp), # store to $temp3
+# begin spilling
+# end of block
 cond_1_after_stf_fact_2_0:
-beq $s2, $t8, if_after2__stf_fact_2_0
-li $t0, 1
-sw $t0, 36($sp)
-lw $v0, 36($sp)
-lw $ra, 16($sp)
-addiu $sp, $sp, 72
-jr $ra
+# start of extended block - loading into registers
+# variable $temp8 is assigned register $v1
+# variable $temp9 is assigned register $t9
+# variable $temp10 is assigned register $t8
+# variable $temp3 is assigned register $t3
+lw, $t3, 4($sp), # load from $temp3
+# variable $temp11 is assigned register $t7
+# variable $temp5 is assigned register $t6
+# variable $temp7 is assigned register $t5
+# variable n_stf_fact_2_0 is assigned register $t4
+lw, $t4, 8($sp), # load from n_stf_fact_2_0
+beq, $t3, 0, if_after2__stf_fact_2_0 # if ($temp3 == 0) goto if_after2__stf_fact_2_0
+li, $v0, 1
+j, fact_st_1_0_epilogue
 if_after2__stf_fact_2_0:
-move $s2, $a0
-li $t8, 1
-sub $t0, $s2, $t8
-sw $t0, 68($sp)
-sw $a0, 72($sp)
-lw $a0, 68($sp)
-jal fact_st_1_0
-lw $a0, 72($sp)
-sw $v0, 24($sp)
-lw $t0, 24($sp)
-sw $t0, r_st_1_0
-move $s2, $a0
-lw $t8, r_st_1_0
-mulo $t0, $s2, $t8
-sw $t0, 52($sp)
-lw $v0, 52($sp)
-lw $ra, 16($sp)
-addiu $sp, $sp, 72
-jr $ra
+move, $t6, $t4
+sub, $t5, $t6, 1
+# spilling for jal
+move, $a0, $t5, # move of $temp7 to fn arg/ret
+jal, fact_st_1_0
+# unspilling
+lw, $t4, 8($sp), # load from n_stf_fact_2_0
+move, $v1, $v0
+sw, $v1, r_st_1_0, # store to r_st_1_0
+move, $t9, $t4
+lw, $t0, r_st_1_0, # load from r_st_1_0
+move, $t8, $t0
+mul, $t7, $t9, $t8
+move, $v0, $t7, # move of $temp11 to fn arg/ret
+fact_st_1_0_epilogue:
+lw, $ra, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
 main:
-addiu $sp, $sp, -40
-sw $ra, 16($sp)
-li $t0, 5
-sw $t0, 24($sp)
-lw $a0, 24($sp)
-jal fact_st_1_0
-sw $v0, 28($sp)
-lw $t0, 28($sp)
-sw $t0, r_st_1_0
-lw $t0, r_st_1_0
-sw $t0, 32($sp)
-lw $a0, 32($sp)
-li $v0, 1
-syscall
-lw $ra, 16($sp)
-addiu $sp, $sp, 40
-jr $ra
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of extended block - loading into registers
+# variable $temp1 is assigned register $t4
+# variable $temp2 is assigned register $t3
+li, $t0, 1
+sw, $t0, r_st_1_0, # store to r_st_1_0
+# spilling for jal
+li, $a0, 5
+jal, fact_st_1_0
+# unspilling
+move, $t4, $v0
+sw, $t4, r_st_1_0, # store to r_st_1_0
+lw, $t0, r_st_1_0, # load from r_st_1_0
+move, $t3, $t0
+move, $a0, $t3, # move of $temp2 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
@@ -0,0 +1,65 @@
+.data
+r_st_1_0: .word 0
+.text
+fact_st_1_0:
+# enter fact_st_1_0
+# variable n_stf_fact_2_0 assigned register $t3
+# variable $temp3 assigned register $t5
+# variable $temp1 assigned register $t4
+# variable $temp11 assigned register $t5
+# variable $temp9 assigned register $t3
+# variable $temp10 assigned register $t5
+# variable $temp8 assigned register $t5
+# variable $temp7 assigned register $t5
+# variable $temp5 assigned register $t5
+move, $t3, $a0, # store to n_stf_fact_2_0
+move, $t4, $t3, # store to $temp1
+li, $t5, 1, # store to $temp3
+bne, $t4, 1, cond_0_stz_stf_fact_2_0 # if ($temp1 != 1) goto cond_0_stz_stf_fact_2_0
+j, cond_1_after_stf_fact_2_0
+cond_0_stz_stf_fact_2_0:
+li, $t5, 0, # store to $temp3
+cond_1_after_stf_fact_2_0:
+beq, $t5, 0, if_after2__stf_fact_2_0 # if ($temp3 == 0) goto if_after2__stf_fact_2_0
+li, $v0, 1
+jr, $ra
+if_after2__stf_fact_2_0:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+move, $t5, $t3, # store to $temp5
+sub, $t5, $t5, 1
+# spilling for jal
+sw, $t3, 0($sp), # store to n_stf_fact_2_0
+move, $a0, $t5, # move of $temp7 to fn arg/ret
+jal, fact_st_1_0
+# unspilling
+lw, $t3, 0($sp), # load from n_stf_fact_2_0
+move, $t5, $v0, # store to $temp8
+sw, $t5, r_st_1_0, # store to r_st_1_0
+lw, $t5, r_st_1_0, # load from r_st_1_0
+mul, $t5, $t3, $t5
+move, $v0, $t5, # move of $temp11 to fn arg/ret
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+# enter main
+# variable $temp2 assigned register $t3
+# variable $temp1 assigned register $t3
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+li, $t0, 1
+sw, $t0, r_st_1_0, # store to r_st_1_0
+# spilling for jal
+li, $a0, 5
+jal, fact_st_1_0
+# unspilling
+move, $t3, $v0, # store to $temp1
+sw, $t3, r_st_1_0, # store to r_st_1_0
+lw, $t3, r_st_1_0, # load from r_st_1_0
+move, $a0, $t3, # move of $temp2 to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
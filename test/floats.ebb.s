@@ -0,0 +1,71 @@
+.data
+_float0: .float 0.0
+_float1: .float 1.5
+_float2: .float 0.5
+_float3: .float 2.0
+.text
+tick:
+addiu, $sp, $sp, -8
+sw, $a0, 0($sp), # store to n
+# start of extended block - loading into registers
+# variable n is assigned register $t4
+lw, $t4, 0($sp), # load from n
+# variable $temp0 is assigned register $t3
+add, $t3, $t4, 1
+move, $v0, $t3, # move of $temp0 to fn arg/ret
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -20
+sw, $ra, 16($sp)
+# start of extended block - loading into registers
+# variable y is assigned register $f6
+l.s, $f0, _float0
+s.s, $f0, 4($sp), # store to x
+l.s, $f6, _float1
+l.s, $f0, _float2
+s.s, $f0, 12($sp), # store to z
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+loop_pre:
+l.s, $f2, _float3
+mul.s, $f4, $f6, $f2
+s.s, $f4, 8($sp), # store to $temp1
+# begin spilling
+# end of block
+loop:
+# start of extended block - loading into registers
+# variable i is assigned register $t3
+lw, $t3, 0($sp), # load from i
+# variable x is assigned register $f8
+l.s, $f8, 4($sp), # load from x
+# variable z is assigned register $f6
+l.s, $f6, 12($sp), # load from z
+# variable $temp1 is assigned register $f10
+l.s, $f10, 8($sp), # load from $temp1
+# variable $temp2 is assigned register $f14
+bge, $t3, 8, done # if (i >= 8) goto done
+add.s, $f8, $f8, $f10
+l.s, $f2, _float2
+sub.s, $f6, $f6, $f2
+l.s, $f2, _float1
+add.s, $f6, $f6, $f2
+# spilling for jal
+move, $a0, $t3, # move of i to fn arg/ret
+jal, tick
+# unspilling
+move, $t3, $v0
+# begin spilling
+sw, $t3, 0($sp), # store to i
+s.s, $f8, 4($sp), # store to x
+s.s, $f6, 12($sp), # store to z
+# end of block
+j, loop
+done:
+add.s, $f14, $f8, $f6
+mov.s, $f12, $f14, # move of $temp2 to fn arg/ret
+li, $v0, 2
+syscall, # printf
+lw, $ra, 16($sp)
+addiu, $sp, $sp, 20
+jr, $ra
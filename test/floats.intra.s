@@ -0,0 +1,78 @@
+.data
+_float0: .float 0.0
+_float1: .float 1.5
+_float2: .float 0.5
+_float3: .float 2.0
+.text
+tick:
+addiu, $sp, $sp, -8
+sw, $a0, 0($sp), # store to n
+# start of block
+lw, $t3, 0($sp), # load from n
+add, $t4, $t3, 1
+# begin spilling
+# end of block
+move, $v0, $t4, # move of $temp0 to fn arg/ret
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -20
+sw, $ra, 16($sp)
+# start of block
+l.s, $f6, _float0
+l.s, $f8, _float1
+l.s, $f10, _float2
+li, $t3, 0
+# begin spilling
+sw, $t3, 0($sp), # store to i
+s.s, $f6, 4($sp), # store to x
+s.s, $f8, 8($sp), # store to y
+s.s, $f10, 12($sp), # store to z
+# end of block
+loop_pre:
+# start of block
+l.s, $f6, 8($sp), # load from y
+l.s, $f2, _float3
+mul.s, $f8, $f6, $f2
+# begin spilling
+s.s, $f8, 8($sp), # store to $temp1
+# end of block
+loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from i
+bge, $t3, 8, done # if (i >= 8) goto done
+# start of block
+l.s, $f6, 4($sp), # load from x
+l.s, $f8, 8($sp), # load from $temp1
+add.s, $f6, $f6, $f8
+l.s, $f10, 12($sp), # load from z
+l.s, $f2, _float2
+sub.s, $f10, $f10, $f2
+l.s, $f2, _float1
+add.s, $f10, $f10, $f2
+# spilling for jal
+lw, $a0, 0($sp), # load from i
+jal, tick
+# unspilling
+move, $t3, $v0
+# begin spilling
+sw, $t3, 0($sp), # store to i
+s.s, $f6, 4($sp), # store to x
+s.s, $f10, 12($sp), # store to z
+# end of block
+j, loop
+done:
+# start of block
+l.s, $f6, 4($sp), # load from x
+l.s, $f8, 12($sp), # load from z
+add.s, $f10, $f6, $f8
+mov.s, $f12, $f10, # move of $temp2 to fn arg/ret
+li, $v0, 2
+syscall, # printf
+# begin spilling
+# end of block
+lw, $ra, 16($sp)
+addiu, $sp, $sp, 20
+jr, $ra
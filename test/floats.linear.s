@@ -0,0 +1,51 @@
+.data
+_float0: .float 0.0
+_float1: .float 1.5
+_float2: .float 0.5
+_float3: .float 2.0
+.text
+tick:
+# enter tick
+# variable n stays in $a0
+# variable $temp0 assigned register $t3
+add, $t3, $a0, 1
+move, $v0, $t3, # move of $temp0 to fn arg/ret
+jr, $ra
+main:
+# enter main
+# variable i assigned register $t3
+# variable x assigned register $f6
+# variable y assigned register $f8
+# variable z assigned register $f10
+# variable $temp1 assigned register $f8
+# variable $temp2 assigned register $f10
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+l.s, $f6, _float0, # store to x
+l.s, $f8, _float1, # store to y
+l.s, $f10, _float2, # store to z
+li, $t3, 0, # store to i
+loop_pre:
+l.s, $f2, _float3
+mul.s, $f8, $f8, $f2
+loop:
+bge, $t3, 8, done # if (i >= 8) goto done
+add.s, $f6, $f6, $f8
+l.s, $f2, _float2
+sub.s, $f10, $f10, $f2
+l.s, $f2, _float1
+add.s, $f10, $f10, $f2
+# spilling for jal
+move, $a0, $t3, # move of i to fn arg/ret
+jal, tick
+# unspilling
+move, $t3, $v0, # store to i
+j, loop
+done:
+add.s, $f10, $f6, $f10
+mov.s, $f12, $f10, # move of $temp2 to fn arg/ret
+li, $v0, 2
+syscall, # printf
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
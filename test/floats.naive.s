@@ -0,0 +1,61 @@
+.data
+_float0: .float 0.0
+_float1: .float 1.5
+_float2: .float 0.5
+_float3: .float 2.0
+.text
+tick:
+addiu, $sp, $sp, -8
+sw, $a0, 0($sp), # store to n
+lw, $t0, 0($sp), # load from n
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to $temp0
+lw, $v0, 0($sp), # load from $temp0
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -20
+sw, $ra, 16($sp)
+l.s, $f0, _float0
+s.s, $f0, 4($sp), # store to x
+l.s, $f0, _float1
+s.s, $f0, 8($sp), # store to y
+l.s, $f0, _float2
+s.s, $f0, 12($sp), # store to z
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+loop_pre:
+l.s, $f0, 8($sp), # load from y
+l.s, $f2, _float3
+mul.s, $f4, $f0, $f2
+s.s, $f4, 8($sp), # store to $temp1
+loop:
+lw, $t0, 0($sp), # load from i
+bge, $t0, 8, done # if (i >= 8) goto done
+l.s, $f0, 4($sp), # load from x
+l.s, $f2, 8($sp), # load from $temp1
+add.s, $f4, $f0, $f2
+s.s, $f4, 4($sp), # store to x
+l.s, $f0, 12($sp), # load from z
+l.s, $f2, _float2
+sub.s, $f4, $f0, $f2
+s.s, $f4, 12($sp), # store to z
+l.s, $f0, 12($sp), # load from z
+l.s, $f2, _float1
+add.s, $f4, $f0, $f2
+s.s, $f4, 12($sp), # store to z
+lw, $a0, 0($sp), # load from i
+jal, tick
+sw, $v0, 0($sp), # store to i
+j, loop
+done:
+l.s, $f0, 4($sp), # load from x
+l.s, $f2, 12($sp), # load from z
+add.s, $f4, $f0, $f2
+s.s, $f4, 0($sp), # store to $temp2
+l.s, $f12, 0($sp), # load from $temp2
+li, $v0, 2
+syscall, # printf
+lw, $ra, 16($sp)
+addiu, $sp, $sp, 20
+jr, $ra
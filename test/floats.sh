@@ -0,0 +1,12 @@
+#!/bin/bash
+
+set -e
+
+./phase2 test/floats.ir $1
+
+diff out.s test/floats.$1.s
+
+spim -f out.s > tmp
+
+diff tmp test/floats.out
+
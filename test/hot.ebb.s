@@ -0,0 +1,138 @@
+.text
+work:
+addiu, $sp, $sp, -64
+sw, $s0, 52($sp)
+sw, $s1, 56($sp)
+sw, $s2, 60($sp)
+sw, $a0, 44($sp), # store to z
+# start of extended block - loading into registers
+# variable a is assigned register $s1
+# variable b is assigned register $s0
+# variable c is assigned register $v1
+# variable d is assigned register $t9
+# variable e is assigned register $t8
+# variable f is assigned register $t7
+# variable g is assigned register $t6
+# variable h is assigned register $t5
+# variable t is assigned register $t3
+# variable z is assigned register $t4
+lw, $t4, 44($sp), # load from z
+add, $s1, $t4, 1
+add, $s0, $t4, 2
+add, $v1, $t4, 3
+add, $t9, $t4, 4
+add, $t8, $t4, 5
+add, $t7, $t4, 6
+add, $t6, $t4, 7
+add, $t5, $t4, 8
+li, $t3, 0
+add, $t3, $t3, $s1
+add, $t3, $t3, $s0
+add, $t3, $t3, $v1
+add, $t3, $t3, $t9
+add, $t3, $t3, $t8
+add, $t3, $t3, $t7
+add, $t3, $t3, $t6
+add, $t3, $t3, $t5
+add, $t3, $t3, $s1
+add, $t3, $t3, $s0
+add, $t3, $t3, $v1
+add, $t3, $t3, $t9
+add, $t3, $t3, $t8
+add, $t3, $t3, $t7
+add, $t3, $t3, $t6
+add, $t3, $t3, $t5
+add, $t3, $t3, $s1
+add, $t3, $t3, $s0
+add, $t3, $t3, $v1
+add, $t3, $t3, $t9
+add, $t3, $t3, $t8
+add, $t3, $t3, $t7
+add, $t3, $t3, $t6
+add, $t3, $t3, $t5
+add, $t3, $t3, $s1
+add, $t3, $t3, $s0
+add, $t3, $t3, $v1
+add, $t3, $t3, $t9
+add, $t3, $t3, $t8
+add, $t3, $t3, $t7
+add, $t3, $t3, $t6
+add, $t3, $t3, $t5
+li, $t0, 0
+sw, $t0, 32($sp), # store to i
+sw, $t3, 40($sp), # store to s
+add, $t2, $t4, 90
+sw, $t2, 36($sp), # store to n
+# begin spilling
+sw, $s1, 0($sp), # store to a
+sw, $s0, 4($sp), # store to b
+sw, $v1, 8($sp), # store to c
+sw, $t9, 12($sp), # store to d
+sw, $t8, 16($sp), # store to e
+sw, $t7, 20($sp), # store to f
+sw, $t6, 24($sp), # store to g
+sw, $t5, 28($sp), # store to h
+# end of block
+loop:
+# start of extended block - loading into registers
+# variable a is assigned register $s2
+lw, $s2, 0($sp), # load from a
+# variable b is assigned register $s1
+lw, $s1, 4($sp), # load from b
+# variable c is assigned register $s0
+lw, $s0, 8($sp), # load from c
+# variable d is assigned register $v1
+lw, $v1, 12($sp), # load from d
+# variable e is assigned register $t9
+lw, $t9, 16($sp), # load from e
+# variable f is assigned register $t8
+lw, $t8, 20($sp), # load from f
+# variable g is assigned register $t7
+lw, $t7, 24($sp), # load from g
+# variable h is assigned register $t6
+lw, $t6, 28($sp), # load from h
+# variable i is assigned register $t3
+lw, $t3, 32($sp), # load from i
+# variable n is assigned register $t5
+lw, $t5, 36($sp), # load from n
+# variable s is assigned register $t4
+lw, $t4, 40($sp), # load from s
+bge, $t3, $t5, done # if (i >= n) goto done
+add, $t4, $t4, $t3
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 32($sp), # store to i
+sw, $t4, 40($sp), # store to s
+# end of block
+j, loop
+done:
+add, $t4, $t4, $s2
+add, $t4, $t4, $s1
+add, $t4, $t4, $s0
+add, $t4, $t4, $v1
+add, $t4, $t4, $t9
+add, $t4, $t4, $t8
+add, $t4, $t4, $t7
+add, $t4, $t4, $t6
+move, $v0, $t4, # move of s to fn arg/ret
+lw, $s0, 52($sp)
+lw, $s1, 56($sp)
+lw, $s2, 60($sp)
+addiu, $sp, $sp, 64
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of extended block - loading into registers
+# variable r is assigned register $t3
+# spilling for jal
+li, $a0, 10
+jal, work
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
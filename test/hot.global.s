@@ -0,0 +1,134 @@
+.text
+work:
+# enter work
+# variable z stays in $a0
+# variable $s.65 goes straight to $v0
+# variable a assigned register $t6
+# variable b assigned register $t7
+# variable c assigned register $t8
+# variable d assigned register $t9
+# variable e assigned register $v1
+# variable f assigned register $s0
+# variable g assigned register $s1
+# variable h assigned register $s2
+# variable i assigned register $t3
+# variable n assigned register $t4
+# variable $t.26 assigned register $t3
+# variable $t.27 assigned register $t3
+# variable $t.28 assigned register $t3
+# variable $t.29 assigned register $t3
+# variable $t.30 assigned register $t3
+# variable $t.31 assigned register $t3
+# variable $t.32 assigned register $t3
+# variable $t.33 assigned register $t3
+# variable $t.34 assigned register $t3
+# variable $t.35 assigned register $t3
+# variable $t.36 assigned register $t3
+# variable $t.37 assigned register $t3
+# variable $t.38 assigned register $t3
+# variable $t.39 assigned register $t3
+# variable $t.40 assigned register $t3
+# variable $t.41 assigned register $t3
+# variable $t.42 assigned register $t3
+# variable $t.43 assigned register $t3
+# variable $t.44 assigned register $t3
+# variable $t.45 assigned register $t3
+# variable $t.46 assigned register $t3
+# variable $t.47 assigned register $t3
+# variable $t.48 assigned register $t3
+# variable $t.49 assigned register $t3
+# variable $t.50 assigned register $t3
+# variable $t.51 assigned register $t3
+# variable $t.52 assigned register $t3
+# variable $t.53 assigned register $t3
+# variable $t.54 assigned register $t3
+# variable $t.55 assigned register $t3
+# variable $t.56 assigned register $t3
+# variable $t.57 assigned register $t5
+# variable $s.58 assigned register $t3
+# variable $s.59 assigned register $t3
+# variable $s.60 assigned register $t3
+# variable $s.61 assigned register $t3
+# variable $s.62 assigned register $t3
+# variable $s.63 assigned register $t3
+# variable $s.64 assigned register $t3
+addiu, $sp, $sp, -20
+sw, $s0, 8($sp)
+sw, $s1, 12($sp)
+sw, $s2, 16($sp)
+add, $t6, $a0, 1
+add, $t7, $a0, 2
+add, $t8, $a0, 3
+add, $t9, $a0, 4
+add, $v1, $a0, 5
+add, $s0, $a0, 6
+add, $s1, $a0, 7
+add, $s2, $a0, 8
+add, $t3, $t6, 0
+add, $t3, $t3, $t7
+add, $t3, $t3, $t8
+add, $t3, $t3, $t9
+add, $t3, $t3, $v1
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+add, $t3, $t3, $s2
+add, $t3, $t3, $t6
+add, $t3, $t3, $t7
+add, $t3, $t3, $t8
+add, $t3, $t3, $t9
+add, $t3, $t3, $v1
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+add, $t3, $t3, $s2
+add, $t3, $t3, $t6
+add, $t3, $t3, $t7
+add, $t3, $t3, $t8
+add, $t3, $t3, $t9
+add, $t3, $t3, $v1
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+add, $t3, $t3, $s2
+add, $t3, $t3, $t6
+add, $t3, $t3, $t7
+add, $t3, $t3, $t8
+add, $t3, $t3, $t9
+add, $t3, $t3, $v1
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+add, $t5, $t3, $s2
+li, $t3, 0, # store to i
+add, $t4, $a0, 90
+loop:
+bge, $t3, $t4, done # if (i >= n) goto done
+add, $t5, $t5, $t3
+add, $t3, $t3, 1
+j, loop
+done:
+add, $t3, $t5, $t6
+add, $t3, $t3, $t7
+add, $t3, $t3, $t8
+add, $t3, $t3, $t9
+add, $t3, $t3, $v1
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+add, $v0, $t3, $s2
+lw, $s0, 8($sp)
+lw, $s1, 12($sp)
+lw, $s2, 16($sp)
+addiu, $sp, $sp, 20
+jr, $ra
+main:
+# enter main
+# variable r goes straight to $a0
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+# spilling for jal
+li, $a0, 10
+jal, work
+# unspilling
+move, $a0, $v0, # store to r
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
@@ -0,0 +1,194 @@
+.text
+work:
+# enter work
+# variable z stays in $a0
+# variable $s.65 goes straight to $v0
+# variable f assigned register $t5
+# variable g assigned register $s0
+# variable h assigned register $s1
+# variable i assigned register $t3
+# variable n assigned register $t4
+# variable $t.26 assigned register $t3
+# variable $t.27 assigned register $t3
+# variable $t.28 assigned register $t3
+# variable $t.29 assigned register $t3
+# variable $t.30 assigned register $t3
+# variable $t.31 assigned register $t3
+# variable $t.32 assigned register $t3
+# variable $t.33 assigned register $t3
+# variable $t.34 assigned register $t3
+# variable $t.35 assigned register $t3
+# variable $t.36 assigned register $t3
+# variable $t.37 assigned register $t3
+# variable $t.38 assigned register $t3
+# variable $t.39 assigned register $t3
+# variable $t.40 assigned register $t3
+# variable $t.41 assigned register $t3
+# variable $t.42 assigned register $t3
+# variable $t.43 assigned register $t3
+# variable $t.44 assigned register $t3
+# variable $t.45 assigned register $t3
+# variable $t.46 assigned register $t3
+# variable $t.47 assigned register $t3
+# variable $t.48 assigned register $t3
+# variable $t.49 assigned register $t3
+# variable $t.50 assigned register $t3
+# variable $t.51 assigned register $t3
+# variable $t.52 assigned register $t3
+# variable $t.53 assigned register $t3
+# variable $t.54 assigned register $t3
+# variable $t.55 assigned register $t3
+# variable $t.56 assigned register $t3
+# variable $t.57 assigned register $s2
+# variable $s.58 assigned register $t3
+# variable $s.59 assigned register $t3
+# variable $s.60 assigned register $t3
+# variable $s.61 assigned register $t3
+# variable $s.62 assigned register $t3
+# variable $s.63 assigned register $t3
+# variable $s.64 assigned register $t3
+# variable $spill.66 assigned register $t3
+# variable $spill.67 assigned register $t3
+# variable $spill.68 assigned register $t3
+# variable $spill.69 assigned register $t3
+# variable $spill.70 assigned register $t3
+# variable $spill.71 assigned register $t3
+# variable $spill.72 assigned register $t4
+# variable $spill.73 assigned register $t4
+# variable $spill.74 assigned register $t4
+# variable $spill.75 assigned register $t4
+# variable $spill.76 assigned register $t4
+# variable $spill.77 assigned register $t4
+# variable $spill.78 assigned register $t4
+# variable $spill.79 assigned register $t4
+# variable $spill.80 assigned register $t4
+# variable $spill.81 assigned register $t4
+# variable $spill.82 assigned register $t4
+# variable $spill.83 assigned register $t4
+# variable $spill.84 assigned register $t4
+# variable $spill.85 assigned register $t4
+# variable $spill.86 assigned register $t4
+# variable $spill.87 assigned register $t4
+# variable $spill.88 assigned register $t4
+# variable $spill.89 assigned register $t4
+# variable $spill.90 assigned register $t4
+# variable $spill.91 assigned register $t3
+# variable $spill.92 assigned register $t4
+# variable $spill.93 assigned register $t4
+# variable $spill.94 assigned register $t4
+# variable $spill.95 assigned register $t4
+# variable a is spilled!
+# variable b is spilled!
+# variable c is spilled!
+# variable d is spilled!
+# variable e is spilled!
+addiu, $sp, $sp, -36
+sw, $s0, 24($sp)
+sw, $s1, 28($sp)
+sw, $s2, 32($sp)
+add, $t3, $a0, 1
+sw, $t3, 0($sp), # store to a
+add, $t3, $a0, 2
+sw, $t3, 4($sp), # store to b
+add, $t3, $a0, 3
+sw, $t3, 8($sp), # store to c
+add, $t3, $a0, 4
+sw, $t3, 12($sp), # store to d
+add, $t3, $a0, 5
+sw, $t3, 16($sp), # store to e
+add, $t5, $a0, 6
+add, $s0, $a0, 7
+add, $s1, $a0, 8
+lw, $t3, 0($sp), # load from a
+add, $t3, $t3, 0
+lw, $t4, 4($sp), # load from b
+add, $t3, $t3, $t4
+lw, $t4, 8($sp), # load from c
+add, $t3, $t3, $t4
+lw, $t4, 12($sp), # load from d
+add, $t3, $t3, $t4
+lw, $t4, 16($sp), # load from e
+add, $t3, $t3, $t4
+add, $t3, $t3, $t5
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+lw, $t4, 0($sp), # load from a
+add, $t3, $t3, $t4
+lw, $t4, 4($sp), # load from b
+add, $t3, $t3, $t4
+lw, $t4, 8($sp), # load from c
+add, $t3, $t3, $t4
+lw, $t4, 12($sp), # load from d
+add, $t3, $t3, $t4
+lw, $t4, 16($sp), # load from e
+add, $t3, $t3, $t4
+add, $t3, $t3, $t5
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+lw, $t4, 0($sp), # load from a
+add, $t3, $t3, $t4
+lw, $t4, 4($sp), # load from b
+add, $t3, $t3, $t4
+lw, $t4, 8($sp), # load from c
+add, $t3, $t3, $t4
+lw, $t4, 12($sp), # load from d
+add, $t3, $t3, $t4
+lw, $t4, 16($sp), # load from e
+add, $t3, $t3, $t4
+add, $t3, $t3, $t5
+add, $t3, $t3, $s0
+add, $t3, $t3, $s1
+lw, $t4, 0($sp), # load from a
+add, $t3, $t3, $t4
+lw, $t4, 4($sp), # load from b
+add, $t3, $t3, $t4
+lw, $t4, 8($sp), # load from c
+add, $t3, $t3, $t4
+lw, $t4, 12($sp), # load from d
+add, $t3, $t3, $t4
+lw, $t4, 16($sp), # load from e
+add, $t3, $t3, $t4
+add, $t3, $t3, $t5
+add, $t3, $t3, $s0
+add, $s2, $t3, $s1
+li, $t3, 0, # store to i
+add, $t4, $a0, 90
+loop:
+bge, $t3, $t4, done # if (i >= n) goto done
+add, $s2, $s2, $t3
+add, $t3, $t3, 1
+j, loop
+done:
+lw, $t3, 0($sp), # load from a
+add, $t3, $s2, $t3
+lw, $t4, 4($sp), # load from b
+add, $t3, $t3, $t4
+lw, $t4, 8($sp), # load from c
+add, $t3, $t3, $t4
+lw, $t4, 12($sp), # load from d
+add, $t3, $t3, $t4
+lw, $t4, 16($sp), # load from e
+add, $t3, $t3, $t4
+add, $t3, $t3, $t5
+add, $t3, $t3, $s0
+add, $v0, $t3, $s1
+lw, $s0, 24($sp)
+lw, $s1, 28($sp)
+lw, $s2, 32($sp)
+addiu, $sp, $sp, 36
+jr, $ra
+main:
+# enter main
+# variable r goes straight to $a0
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+# spilling for jal
+li, $a0, 10
+jal, work
+# unspilling
+move, $a0, $v0, # store to r
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
@@ -0,0 +1,131 @@
+.text
+work:
+addiu, $sp, $sp, -72
+sw, $s0, 52($sp)
+sw, $s1, 56($sp)
+sw, $s2, 60($sp)
+sw, $s3, 64($sp)
+sw, $s4, 68($sp)
+sw, $a0, 44($sp), # store to z
+# start of block
+lw, $t3, 44($sp), # load from z
+add, $t4, $t3, 1
+add, $t5, $t3, 2
+add, $t6, $t3, 3
+add, $t7, $t3, 4
+add, $t8, $t3, 5
+add, $t9, $t3, 6
+add, $v1, $t3, 7
+add, $s0, $t3, 8
+li, $s1, 0
+add, $s1, $s1, $t4
+add, $s1, $s1, $t5
+add, $s1, $s1, $t6
+add, $s1, $s1, $t7
+add, $s1, $s1, $t8
+add, $s1, $s1, $t9
+add, $s1, $s1, $v1
+add, $s1, $s1, $s0
+add, $s1, $s1, $t4
+add, $s1, $s1, $t5
+add, $s1, $s1, $t6
+add, $s1, $s1, $t7
+add, $s1, $s1, $t8
+add, $s1, $s1, $t9
+add, $s1, $s1, $v1
+add, $s1, $s1, $s0
+add, $s1, $s1, $t4
+add, $s1, $s1, $t5
+add, $s1, $s1, $t6
+add, $s1, $s1, $t7
+add, $s1, $s1, $t8
+add, $s1, $s1, $t9
+add, $s1, $s1, $v1
+add, $s1, $s1, $s0
+add, $s1, $s1, $t4
+add, $s1, $s1, $t5
+add, $s1, $s1, $t6
+add, $s1, $s1, $t7
+add, $s1, $s1, $t8
+add, $s1, $s1, $t9
+add, $s1, $s1, $v1
+add, $s1, $s1, $s0
+li, $s2, 0
+move, $s3, $s1
+add, $s4, $t3, 90
+# begin spilling
+sw, $t4, 0($sp), # store to a
+sw, $t5, 4($sp), # store to b
+sw, $t6, 8($sp), # store to c
+sw, $t7, 12($sp), # store to d
+sw, $t8, 16($sp), # store to e
+sw, $t9, 20($sp), # store to f
+sw, $v1, 24($sp), # store to g
+sw, $s0, 28($sp), # store to h
+sw, $s2, 32($sp), # store to i
+sw, $s3, 40($sp), # store to s
+sw, $s4, 36($sp), # store to n
+# end of block
+loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 32($sp), # load from i
+lw, $t4, 36($sp), # load from n
+bge, $t3, $t4, done # if (i >= n) goto done
+# start of block
+lw, $t3, 40($sp), # load from s
+lw, $t4, 32($sp), # load from i
+add, $t3, $t3, $t4
+add, $t4, $t4, 1
+# begin spilling
+sw, $t3, 40($sp), # store to s
+sw, $t4, 32($sp), # store to i
+# end of block
+j, loop
+done:
+# start of block
+lw, $t3, 40($sp), # load from s
+lw, $t4, 0($sp), # load from a
+add, $t3, $t3, $t4
+lw, $t5, 4($sp), # load from b
+add, $t3, $t3, $t5
+lw, $t6, 8($sp), # load from c
+add, $t3, $t3, $t6
+lw, $t7, 12($sp), # load from d
+add, $t3, $t3, $t7
+lw, $t8, 16($sp), # load from e
+add, $t3, $t3, $t8
+lw, $t9, 20($sp), # load from f
+add, $t3, $t3, $t9
+lw, $v1, 24($sp), # load from g
+add, $t3, $t3, $v1
+lw, $s0, 28($sp), # load from h
+add, $t3, $t3, $s0
+# begin spilling
+# end of block
+move, $v0, $t3, # move of s to fn arg/ret
+lw, $s0, 52($sp)
+lw, $s1, 56($sp)
+lw, $s2, 60($sp)
+lw, $s3, 64($sp)
+lw, $s4, 68($sp)
+addiu, $sp, $sp, 72
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of block
+# spilling for jal
+li, $a0, 10
+jal, work
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
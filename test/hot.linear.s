@@ -0,0 +1,99 @@
+.text
+work:
+# enter work
+# variable z stays in $a0
+# variable a assigned register $t3
+# variable b assigned register $t4
+# variable c assigned register $t5
+# variable d assigned register $t6
+# variable e assigned register $t7
+# variable f assigned register $t8
+# variable g assigned register $t9
+# variable h assigned register $v1
+# variable i assigned register $s1
+# variable n assigned register $s2
+# variable s assigned register $s0
+# variable t assigned register $s0
+addiu, $sp, $sp, -16
+sw, $s0, 4($sp)
+sw, $s1, 8($sp)
+sw, $s2, 12($sp)
+add, $t3, $a0, 1
+add, $t4, $a0, 2
+add, $t5, $a0, 3
+add, $t6, $a0, 4
+add, $t7, $a0, 5
+add, $t8, $a0, 6
+add, $t9, $a0, 7
+add, $v1, $a0, 8
+li, $s0, 0, # store to t
+add, $s0, $s0, $t3
+add, $s0, $s0, $t4
+add, $s0, $s0, $t5
+add, $s0, $s0, $t6
+add, $s0, $s0, $t7
+add, $s0, $s0, $t8
+add, $s0, $s0, $t9
+add, $s0, $s0, $v1
+add, $s0, $s0, $t3
+add, $s0, $s0, $t4
+add, $s0, $s0, $t5
+add, $s0, $s0, $t6
+add, $s0, $s0, $t7
+add, $s0, $s0, $t8
+add, $s0, $s0, $t9
+add, $s0, $s0, $v1
+add, $s0, $s0, $t3
+add, $s0, $s0, $t4
+add, $s0, $s0, $t5
+add, $s0, $s0, $t6
+add, $s0, $s0, $t7
+add, $s0, $s0, $t8
+add, $s0, $s0, $t9
+add, $s0, $s0, $v1
+add, $s0, $s0, $t3
+add, $s0, $s0, $t4
+add, $s0, $s0, $t5
+add, $s0, $s0, $t6
+add, $s0, $s0, $t7
+add, $s0, $s0, $t8
+add, $s0, $s0, $t9
+add, $s0, $s0, $v1
+li, $s1, 0, # store to i
+add, $s2, $a0, 90
+loop:
+bge, $s1, $s2, done # if (i >= n) goto done
+add, $s0, $s0, $s1
+add, $s1, $s1, 1
+j, loop
+done:
+add, $s0, $s0, $t3
+add, $s0, $s0, $t4
+add, $s0, $s0, $t5
+add, $s0, $s0, $t6
+add, $s0, $s0, $t7
+add, $s0, $s0, $t8
+add, $s0, $s0, $t9
+add, $s0, $s0, $v1
+move, $v0, $s0, # move of s to fn arg/ret
+lw, $s0, 4($sp)
+lw, $s1, 8($sp)
+lw, $s2, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
+main:
+# enter main
+# variable r assigned register $t3
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+# spilling for jal
+li, $a0, 10
+jal, work
+# unspilling
+move, $t3, $v0, # store to r
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
@@ -0,0 +1,129 @@
+.text
+work:
+# enter work
+# variable z stays in $a0
+# variable a assigned register $t3
+# variable b assigned register $t4
+# variable c assigned register $t5
+# variable d is spilled!
+# variable e is spilled!
+# variable f is spilled!
+# variable g is spilled!
+# variable h is spilled!
+# variable i assigned register $s1
+# variable n assigned register $s0
+# variable s assigned register $s2
+# variable t assigned register $s2
+addiu, $sp, $sp, -36
+sw, $s0, 24($sp)
+sw, $s1, 28($sp)
+sw, $s2, 32($sp)
+add, $t3, $a0, 1
+add, $t4, $a0, 2
+add, $t5, $a0, 3
+add, $t2, $a0, 4
+sw, $t2, 0($sp), # store to d
+add, $t2, $a0, 5
+sw, $t2, 4($sp), # store to e
+add, $t2, $a0, 6
+sw, $t2, 8($sp), # store to f
+add, $t2, $a0, 7
+sw, $t2, 12($sp), # store to g
+add, $t2, $a0, 8
+sw, $t2, 16($sp), # store to h
+li, $s2, 0, # store to t
+add, $s2, $s2, $t3
+add, $s2, $s2, $t4
+add, $s2, $s2, $t5
+lw, $t1, 0($sp), # load from d
+add, $s2, $s2, $t1
+lw, $t1, 4($sp), # load from e
+add, $s2, $s2, $t1
+lw, $t1, 8($sp), # load from f
+add, $s2, $s2, $t1
+lw, $t1, 12($sp), # load from g
+add, $s2, $s2, $t1
+lw, $t1, 16($sp), # load from h
+add, $s2, $s2, $t1
+add, $s2, $s2, $t3
+add, $s2, $s2, $t4
+add, $s2, $s2, $t5
+lw, $t1, 0($sp), # load from d
+add, $s2, $s2, $t1
+lw, $t1, 4($sp), # load from e
+add, $s2, $s2, $t1
+lw, $t1, 8($sp), # load from f
+add, $s2, $s2, $t1
+lw, $t1, 12($sp), # load from g
+add, $s2, $s2, $t1
+lw, $t1, 16($sp), # load from h
+add, $s2, $s2, $t1
+add, $s2, $s2, $t3
+add, $s2, $s2, $t4
+add, $s2, $s2, $t5
+lw, $t1, 0($sp), # load from d
+add, $s2, $s2, $t1
+lw, $t1, 4($sp), # load from e
+add, $s2, $s2, $t1
+lw, $t1, 8($sp), # load from f
+add, $s2, $s2, $t1
+lw, $t1, 12($sp), # load from g
+add, $s2, $s2, $t1
+lw, $t1, 16($sp), # load from h
+add, $s2, $s2, $t1
+add, $s2, $s2, $t3
+add, $s2, $s2, $t4
+add, $s2, $s2, $t5
+lw, $t1, 0($sp), # load from d
+add, $s2, $s2, $t1
+lw, $t1, 4($sp), # load from e
+add, $s2, $s2, $t1
+lw, $t1, 8($sp), # load from f
+add, $s2, $s2, $t1
+lw, $t1, 12($sp), # load from g
+add, $s2, $s2, $t1
+lw, $t1, 16($sp), # load from h
+add, $s2, $s2, $t1
+li, $s1, 0, # store to i
+add, $s0, $a0, 90
+loop:
+bge, $s1, $s0, done # if (i >= n) goto done
+add, $s2, $s2, $s1
+add, $s1, $s1, 1
+j, loop
+done:
+add, $s2, $s2, $t3
+add, $s2, $s2, $t4
+add, $s2, $s2, $t5
+lw, $t1, 0($sp), # load from d
+add, $s2, $s2, $t1
+lw, $t1, 4($sp), # load from e
+add, $s2, $s2, $t1
+lw, $t1, 8($sp), # load from f
+add, $s2, $s2, $t1
+lw, $t1, 12($sp), # load from g
+add, $s2, $s2, $t1
+lw, $t1, 16($sp), # load from h
+add, $s2, $s2, $t1
+move, $v0, $s2, # move of s to fn arg/ret
+lw, $s0, 24($sp)
+lw, $s1, 28($sp)
+lw, $s2, 32($sp)
+addiu, $sp, $sp, 36
+jr, $ra
+main:
+# enter main
+# variable r assigned register $t3
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+# spilling for jal
+li, $a0, 10
+jal, work
+# unspilling
+move, $t3, $v0, # store to r
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
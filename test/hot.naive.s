@@ -0,0 +1,225 @@
+.text
+work:
+addiu, $sp, $sp, -52
+sw, $a0, 44($sp), # store to z
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to a
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 2
+sw, $t2, 4($sp), # store to b
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 3
+sw, $t2, 8($sp), # store to c
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 4
+sw, $t2, 12($sp), # store to d
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 5
+sw, $t2, 16($sp), # store to e
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 6
+sw, $t2, 20($sp), # store to f
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 7
+sw, $t2, 24($sp), # store to g
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 8
+sw, $t2, 28($sp), # store to h
+li, $t0, 0
+sw, $t0, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 0($sp), # load from a
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 4($sp), # load from b
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 8($sp), # load from c
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 12($sp), # load from d
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 16($sp), # load from e
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 20($sp), # load from f
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 24($sp), # load from g
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 28($sp), # load from h
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 0($sp), # load from a
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 4($sp), # load from b
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 8($sp), # load from c
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 12($sp), # load from d
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 16($sp), # load from e
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 20($sp), # load from f
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 24($sp), # load from g
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 28($sp), # load from h
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 0($sp), # load from a
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 4($sp), # load from b
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 8($sp), # load from c
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 12($sp), # load from d
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 16($sp), # load from e
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 20($sp), # load from f
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 24($sp), # load from g
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 28($sp), # load from h
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 0($sp), # load from a
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 4($sp), # load from b
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 8($sp), # load from c
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 12($sp), # load from d
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 16($sp), # load from e
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 20($sp), # load from f
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 24($sp), # load from g
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+lw, $t0, 36($sp), # load from t
+lw, $t1, 28($sp), # load from h
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to t
+li, $t0, 0
+sw, $t0, 32($sp), # store to i
+lw, $t0, 36($sp), # load from t
+sw, $t0, 40($sp), # store to s
+lw, $t0, 44($sp), # load from z
+add, $t2, $t0, 90
+sw, $t2, 36($sp), # store to n
+loop:
+lw, $t0, 32($sp), # load from i
+lw, $t1, 36($sp), # load from n
+bge, $t0, $t1, done # if (i >= n) goto done
+lw, $t0, 40($sp), # load from s
+lw, $t1, 32($sp), # load from i
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 32($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 32($sp), # store to i
+j, loop
+done:
+lw, $t0, 40($sp), # load from s
+lw, $t1, 0($sp), # load from a
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 40($sp), # load from s
+lw, $t1, 4($sp), # load from b
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 40($sp), # load from s
+lw, $t1, 8($sp), # load from c
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 40($sp), # load from s
+lw, $t1, 12($sp), # load from d
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 40($sp), # load from s
+lw, $t1, 16($sp), # load from e
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 40($sp), # load from s
+lw, $t1, 20($sp), # load from f
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 40($sp), # load from s
+lw, $t1, 24($sp), # load from g
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $t0, 40($sp), # load from s
+lw, $t1, 28($sp), # load from h
+add, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to s
+lw, $v0, 40($sp), # load from s
+addiu, $sp, $sp, 52
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+li, $a0, 10
+jal, work
+sw, $v0, 0($sp), # store to r
+lw, $a0, 0($sp), # load from r
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
@@ -0,0 +1,204 @@
+.data
+g: .word 0
+.text
+bump:
+# start of extended block - loading into registers
+lw, $t0, g, # load from g
+add, $t2, $t0, 1
+sw, $t2, g, # store to g
+jr, $ra
+work:
+addiu, $sp, $sp, -48
+sw, $ra, 40($sp)
+sw, $s0, 44($sp)
+sw, $a0, 0($sp), # store to n
+sw, $a1, 4($sp), # store to k
+# start of extended block - loading into registers
+# variable n is assigned register $t3
+lw, $t3, 0($sp), # load from n
+li, $t0, 0
+sw, $t0, 36($sp), # store to s
+li, $t0, 0
+sw, $t0, 20($sp), # store to e
+li, $t0, 0
+sw, $t0, 24($sp), # store to i
+outer_pre:
+mul, $t2, $t3, 3
+sw, $t2, 8($sp), # store to a
+# begin spilling
+# end of block
+outer:
+# start of extended block - loading into registers
+# variable n is assigned register $t4
+lw, $t4, 0($sp), # load from n
+# variable e is assigned register $t6
+lw, $t6, 20($sp), # load from e
+# variable i is assigned register $t3
+lw, $t3, 24($sp), # load from i
+# variable s is assigned register $t5
+lw, $t5, 36($sp), # load from s
+bge, $t3, $t4, outer_done # if (i >= n) goto outer_done
+li, $t0, 0
+sw, $t0, 28($sp), # store to j
+# begin spilling
+# end of block
+inner:
+# start of extended block - loading into registers
+# variable n is assigned register $t6
+lw, $t6, 0($sp), # load from n
+# variable k is assigned register $t3
+lw, $t3, 4($sp), # load from k
+# variable a is assigned register $v1
+lw, $v1, 8($sp), # load from a
+# variable b is assigned register $t9
+# variable c is assigned register $t8
+# variable i is assigned register $s0
+lw, $s0, 24($sp), # load from i
+# variable j is assigned register $t5
+lw, $t5, 28($sp), # load from j
+# variable q is assigned register $t7
+# variable s is assigned register $t4
+lw, $t4, 36($sp), # load from s
+bge, $t5, $t3, inner_done # if (j >= k) goto inner_done
+add, $t9, $v1, $t3
+lw, $t0, g, # load from g
+add, $t8, $t0, 1
+div, $t7, $t6, $t3
+add, $t4, $t4, $t9
+add, $t4, $t4, $t8
+add, $t4, $t4, $t7
+add, $t5, $t5, 1
+# begin spilling
+sw, $t5, 28($sp), # store to j
+sw, $t4, 36($sp), # store to s
+# end of block
+j, inner
+inner_done:
+add, $t2, $s0, $t5
+sw, $t2, 12($sp), # store to d
+# begin spilling
+# end of block
+beq, $s0, 2, skip # if (i == 2) goto skip
+sub, $t2, $t6, $t3
+sw, $t2, 20($sp), # store to e
+# begin spilling
+# end of block
+skip:
+# start of extended block - loading into registers
+# variable d is assigned register $t5
+lw, $t5, 12($sp), # load from d
+# variable i is assigned register $t4
+lw, $t4, 24($sp), # load from i
+# variable s is assigned register $t3
+lw, $t3, 36($sp), # load from s
+# spilling for jal
+jal, bump
+# unspilling
+add, $t3, $t3, $t5
+add, $t4, $t4, 1
+# begin spilling
+sw, $t4, 24($sp), # store to i
+sw, $t3, 36($sp), # store to s
+# end of block
+j, outer
+outer_done:
+add, $t5, $t5, $t6
+move, $v0, $t5, # move of s to fn arg/ret
+lw, $s0, 44($sp)
+lw, $ra, 40($sp)
+addiu, $sp, $sp, 48
+jr, $ra
+guarded:
+addiu, $sp, $sp, -24
+sw, $a0, 0($sp), # store to u
+sw, $a1, 4($sp), # store to v
+# start of extended block - loading into registers
+# variable u is assigned register $t4
+lw, $t4, 0($sp), # load from u
+# variable v is assigned register $t3
+lw, $t3, 4($sp), # load from v
+li, $t0, 0
+sw, $t0, 8($sp), # store to m
+li, $t0, 0
+sw, $t0, 12($sp), # store to t
+each_pre:
+add, $t2, $t4, $t3
+sw, $t2, 16($sp), # store to x
+# begin spilling
+# end of block
+each:
+# start of extended block - loading into registers
+# variable m is assigned register $t3
+lw, $t3, 8($sp), # load from m
+# variable t is assigned register $t5
+lw, $t5, 12($sp), # load from t
+# variable x is assigned register $t4
+lw, $t4, 16($sp), # load from x
+add, $t5, $t5, $t4
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 8($sp), # store to m
+sw, $t5, 12($sp), # store to t
+# end of block
+blt, $t3, 3, each # if (m < 3) goto each
+guard:
+# start of extended block - loading into registers
+# variable u is assigned register $t7
+lw, $t7, 0($sp), # load from u
+# variable v is assigned register $t6
+lw, $t6, 4($sp), # load from v
+# variable m is assigned register $t3
+lw, $t3, 8($sp), # load from m
+# variable t is assigned register $t4
+lw, $t4, 12($sp), # load from t
+# variable y is assigned register $t5
+bge, $t3, 6, guard_done # if (m >= 6) goto guard_done
+# begin spilling
+# end of block
+bne, $t3, 100, unused # if (m != 100) goto unused
+sub, $t5, $t7, $t6
+add, $t4, $t4, $t5
+# begin spilling
+sw, $t4, 12($sp), # store to t
+# end of block
+unused:
+# start of extended block - loading into registers
+# variable m is assigned register $t3
+lw, $t3, 8($sp), # load from m
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 8($sp), # store to m
+# end of block
+j, guard
+guard_done:
+move, $v0, $t4, # move of t to fn arg/ret
+addiu, $sp, $sp, 24
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of extended block - loading into registers
+# variable r is assigned register $t3
+li, $t0, 10
+sw, $t0, g, # store to g
+# spilling for jal
+li, $a0, 5
+li, $a1, 3
+jal, work
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+li, $a0, 2000000000
+li, $a1, -1999999990
+jal, guarded
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
@@ -0,0 +1,122 @@
+.data
+g: .word 0
+.text
+bump:
+# enter bump
+lw, $t0, g, # load from g
+add, $t2, $t0, 1
+sw, $t2, g, # store to g
+jr, $ra
+work:
+# enter work
+# variable $s.27 goes straight to $v0
+# variable n assigned register $t3
+# variable k assigned register $t4
+# variable a assigned register $t8
+# variable b assigned register $s1
+# variable c assigned register $s0
+# variable d assigned register $t9
+# variable e assigned register $t5
+# variable i assigned register $t6
+# variable j assigned register $t9
+# variable q assigned register $v1
+# variable s assigned register $t7
+# variable $s.25 assigned register $t7
+# variable $s.26 assigned register $t7
+addiu, $sp, $sp, -12
+sw, $ra, 0($sp)
+sw, $s0, 4($sp)
+sw, $s1, 8($sp)
+move, $t3, $a0, # store to n
+move, $t4, $a1, # store to k
+li, $t7, 0, # store to s
+li, $t5, 0, # store to e
+li, $t6, 0, # store to i
+outer_pre:
+mul, $t8, $t3, 3
+outer:
+bge, $t6, $t3, outer_done # if (i >= n) goto outer_done
+li, $t9, 0, # store to j
+inner:
+bge, $t9, $t4, inner_done # if (j >= k) goto inner_done
+add, $s1, $t8, $t4
+lw, $t0, g, # load from g
+add, $s0, $t0, 1
+div, $v1, $t3, $t4
+add, $t7, $t7, $s1
+add, $t7, $t7, $s0
+add, $t7, $t7, $v1
+add, $t9, $t9, 1
+j, inner
+inner_done:
+add, $t9, $t6, $t9
+beq, $t6, 2, skip # if (i == 2) goto skip
+sub, $t5, $t3, $t4
+skip:
+# spilling for jal
+jal, bump
+# unspilling
+add, $t7, $t7, $t9
+add, $t6, $t6, 1
+j, outer
+outer_done:
+add, $v0, $t7, $t5
+lw, $s0, 4($sp)
+lw, $s1, 8($sp)
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 12
+jr, $ra
+guarded:
+# enter guarded
+# variable u stays in $a0
+# variable v stays in $a1
+# variable m assigned register $t3
+# variable t assigned register $t4
+# variable x assigned register $t5
+# variable y assigned register $t5
+li, $t3, 0, # store to m
+li, $t4, 0, # store to t
+each_pre:
+add, $t5, $a0, $a1
+each:
+add, $t4, $t4, $t5
+add, $t3, $t3, 1
+blt, $t3, 3, each # if (m < 3) goto each
+guard:
+bge, $t3, 6, guard_done # if (m >= 6) goto guard_done
+bne, $t3, 100, unused # if (m != 100) goto unused
+sub, $t5, $a0, $a1
+add, $t4, $t4, $t5
+unused:
+add, $t3, $t3, 1
+j, guard
+guard_done:
+move, $v0, $t4, # move of t to fn arg/ret
+jr, $ra
+main:
+# enter main
+# variable r goes straight to $a0
+# variable $r.11 goes straight to $a0
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+li, $t0, 10
+sw, $t0, g, # store to g
+# spilling for jal
+li, $a0, 5
+li, $a1, 3
+jal, work
+# unspilling
+move, $a0, $v0, # store to r
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+li, $a0, 2000000000
+li, $a1, -1999999990
+jal, guarded
+# unspilling
+move, $a0, $v0, # store to $r.11
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
@@ -0,0 +1,209 @@
+.data
+g: .word 0
+.text
+bump:
+# start of block
+lw, $t0, g, # load from g
+add, $t2, $t0, 1
+sw, $t2, g, # store to g
+# begin spilling
+# end of block
+jr, $ra
+work:
+addiu, $sp, $sp, -48
+sw, $ra, 40($sp)
+sw, $s0, 44($sp)
+sw, $a0, 0($sp), # store to n
+sw, $a1, 4($sp), # store to k
+# start of block
+li, $t3, 0
+li, $t4, 0
+li, $t5, 0
+# begin spilling
+sw, $t3, 36($sp), # store to s
+sw, $t4, 20($sp), # store to e
+sw, $t5, 24($sp), # store to i
+# end of block
+outer_pre:
+# start of block
+lw, $t3, 0($sp), # load from n
+mul, $t4, $t3, 3
+# begin spilling
+sw, $t4, 8($sp), # store to a
+# end of block
+outer:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 24($sp), # load from i
+lw, $t4, 0($sp), # load from n
+bge, $t3, $t4, outer_done # if (i >= n) goto outer_done
+# start of block
+li, $t3, 0
+# begin spilling
+sw, $t3, 28($sp), # store to j
+# end of block
+inner:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 28($sp), # load from j
+lw, $t4, 4($sp), # load from k
+bge, $t3, $t4, inner_done # if (j >= k) goto inner_done
+# start of block
+lw, $t3, 8($sp), # load from a
+lw, $t4, 4($sp), # load from k
+add, $t5, $t3, $t4
+lw, $t0, g, # load from g
+add, $t6, $t0, 1
+lw, $t7, 0($sp), # load from n
+div, $t8, $t7, $t4
+lw, $t9, 36($sp), # load from s
+add, $t9, $t9, $t5
+add, $t9, $t9, $t6
+add, $t9, $t9, $t8
+lw, $v1, 28($sp), # load from j
+add, $v1, $v1, 1
+# begin spilling
+sw, $t9, 36($sp), # store to s
+sw, $v1, 28($sp), # store to j
+# end of block
+j, inner
+inner_done:
+# start of block
+lw, $t3, 24($sp), # load from i
+lw, $t4, 28($sp), # load from j
+add, $t5, $t3, $t4
+# begin spilling
+sw, $t5, 12($sp), # store to d
+# end of block
+beq, $t3, 2, skip # if (i == 2) goto skip
+# start of block
+lw, $t3, 0($sp), # load from n
+lw, $t4, 4($sp), # load from k
+sub, $t5, $t3, $t4
+# begin spilling
+sw, $t5, 20($sp), # store to e
+# end of block
+skip:
+# start of block
+# spilling for jal
+jal, bump
+# unspilling
+lw, $t3, 36($sp), # load from s
+lw, $t4, 12($sp), # load from d
+add, $t3, $t3, $t4
+lw, $t5, 24($sp), # load from i
+add, $t5, $t5, 1
+# begin spilling
+sw, $t3, 36($sp), # store to s
+sw, $t5, 24($sp), # store to i
+# end of block
+j, outer
+outer_done:
+# start of block
+lw, $t3, 36($sp), # load from s
+lw, $t4, 20($sp), # load from e
+add, $t3, $t3, $t4
+# begin spilling
+# end of block
+move, $v0, $t3, # move of s to fn arg/ret
+lw, $s0, 44($sp)
+lw, $ra, 40($sp)
+addiu, $sp, $sp, 48
+jr, $ra
+guarded:
+addiu, $sp, $sp, -24
+sw, $a0, 0($sp), # store to u
+sw, $a1, 4($sp), # store to v
+# start of block
+li, $t3, 0
+li, $t4, 0
+# begin spilling
+sw, $t3, 8($sp), # store to m
+sw, $t4, 12($sp), # store to t
+# end of block
+each_pre:
+# start of block
+lw, $t3, 0($sp), # load from u
+lw, $t4, 4($sp), # load from v
+add, $t5, $t3, $t4
+# begin spilling
+sw, $t5, 16($sp), # store to x
+# end of block
+each:
+# start of block
+lw, $t3, 12($sp), # load from t
+lw, $t4, 16($sp), # load from x
+add, $t3, $t3, $t4
+lw, $t5, 8($sp), # load from m
+add, $t5, $t5, 1
+# begin spilling
+sw, $t3, 12($sp), # store to t
+sw, $t5, 8($sp), # store to m
+# end of block
+blt, $t5, 3, each # if (m < 3) goto each
+guard:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 8($sp), # load from m
+bge, $t3, 6, guard_done # if (m >= 6) goto guard_done
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 8($sp), # load from m
+bne, $t3, 100, unused # if (m != 100) goto unused
+# start of block
+lw, $t3, 0($sp), # load from u
+lw, $t4, 4($sp), # load from v
+sub, $t5, $t3, $t4
+lw, $t6, 12($sp), # load from t
+add, $t6, $t6, $t5
+# begin spilling
+sw, $t6, 12($sp), # store to t
+# end of block
+unused:
+# start of block
+lw, $t3, 8($sp), # load from m
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 8($sp), # store to m
+# end of block
+j, guard
+guard_done:
+# start of block
+# begin spilling
+# end of block
+lw, $v0, 12($sp), # load from t
+addiu, $sp, $sp, 24
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+# start of block
+li, $t0, 10
+sw, $t0, g, # store to g
+# spilling for jal
+li, $a0, 5
+li, $a1, 3
+jal, work
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# spilling for jal
+li, $a0, 2000000000
+li, $a1, -1999999990
+jal, guarded
+# unspilling
+move, $t3, $v0
+move, $a0, $t3, # move of r to fn arg/ret
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
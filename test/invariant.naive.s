@@ -0,0 +1,157 @@
+.data
+g: .word 0
+.text
+bump:
+lw, $t0, g, # load from g
+add, $t2, $t0, 1
+sw, $t2, g, # store to g
+jr, $ra
+work:
+addiu, $sp, $sp, -44
+sw, $ra, 40($sp)
+sw, $a0, 0($sp), # store to n
+sw, $a1, 4($sp), # store to k
+li, $t0, 0
+sw, $t0, 36($sp), # store to s
+li, $t0, 0
+sw, $t0, 20($sp), # store to e
+li, $t0, 0
+sw, $t0, 24($sp), # store to i
+outer_pre:
+lw, $t0, 0($sp), # load from n
+mul, $t2, $t0, 3
+sw, $t2, 8($sp), # store to a
+outer:
+lw, $t0, 24($sp), # load from i
+lw, $t1, 0($sp), # load from n
+bge, $t0, $t1, outer_done # if (i >= n) goto outer_done
+li, $t0, 0
+sw, $t0, 28($sp), # store to j
+inner:
+lw, $t0, 28($sp), # load from j
+lw, $t1, 4($sp), # load from k
+bge, $t0, $t1, inner_done # if (j >= k) goto inner_done
+lw, $t0, 8($sp), # load from a
+lw, $t1, 4($sp), # load from k
+add, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to b
+lw, $t0, g, # load from g
+add, $t2, $t0, 1
+sw, $t2, 16($sp), # store to c
+lw, $t0, 0($sp), # load from n
+lw, $t1, 4($sp), # load from k
+div, $t2, $t0, $t1
+sw, $t2, 32($sp), # store to q
+lw, $t0, 36($sp), # load from s
+lw, $t1, 12($sp), # load from b
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 36($sp), # load from s
+lw, $t1, 16($sp), # load from c
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 36($sp), # load from s
+lw, $t1, 32($sp), # load from q
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 28($sp), # load from j
+add, $t2, $t0, 1
+sw, $t2, 28($sp), # store to j
+j, inner
+inner_done:
+lw, $t0, 24($sp), # load from i
+lw, $t1, 28($sp), # load from j
+add, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to d
+lw, $t0, 24($sp), # load from i
+beq, $t0, 2, skip # if (i == 2) goto skip
+lw, $t0, 0($sp), # load from n
+lw, $t1, 4($sp), # load from k
+sub, $t2, $t0, $t1
+sw, $t2, 20($sp), # store to e
+skip:
+jal, bump
+lw, $t0, 36($sp), # load from s
+lw, $t1, 12($sp), # load from d
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 24($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 24($sp), # store to i
+j, outer
+outer_done:
+lw, $t0, 36($sp), # load from s
+lw, $t1, 20($sp), # load from e
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $v0, 36($sp), # load from s
+lw, $ra, 40($sp)
+addiu, $sp, $sp, 44
+jr, $ra
+guarded:
+addiu, $sp, $sp, -24
+sw, $a0, 0($sp), # store to u
+sw, $a1, 4($sp), # store to v
+li, $t0, 0
+sw, $t0, 8($sp), # store to m
+li, $t0, 0
+sw, $t0, 12($sp), # store to t
+each_pre:
+lw, $t0, 0($sp), # load from u
+lw, $t1, 4($sp), # load from v
+add, $t2, $t0, $t1
+sw, $t2, 16($sp), # store to x
+each:
+lw, $t0, 12($sp), # load from t
+lw, $t1, 16($sp), # load from x
+add, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to t
+lw, $t0, 8($sp), # load from m
+add, $t2, $t0, 1
+sw, $t2, 8($sp), # store to m
+lw, $t0, 8($sp), # load from m
+blt, $t0, 3, each # if (m < 3) goto each
+guard:
+lw, $t0, 8($sp), # load from m
+bge, $t0, 6, guard_done # if (m >= 6) goto guard_done
+lw, $t0, 8($sp), # load from m
+bne, $t0, 100, unused # if (m != 100) goto unused
+lw, $t0, 0($sp), # load from u
+lw, $t1, 4($sp), # load from v
+sub, $t2, $t0, $t1
+sw, $t2, 16($sp), # store to y
+lw, $t0, 12($sp), # load from t
+lw, $t1, 16($sp), # load from y
+add, $t2, $t0, $t1
+sw, $t2, 12($sp), # store to t
+unused:
+lw, $t0, 8($sp), # load from m
+add, $t2, $t0, 1
+sw, $t2, 8($sp), # store to m
+j, guard
+guard_done:
+lw, $v0, 12($sp), # load from t
+addiu, $sp, $sp, 24
+jr, $ra
+main:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+li, $t0, 10
+sw, $t0, g, # store to g
+li, $a0, 5
+li, $a1, 3
+jal, work
+sw, $v0, 0($sp), # store to r
+lw, $a0, 0($sp), # load from r
+li, $v0, 1
+syscall, # printi
+li, $a0, 2000000000
+li, $a1, -1999999990
+jal, guarded
+sw, $v0, 0($sp), # store to r
+lw, $a0, 0($sp), # load from r
+li, $v0, 1
+syscall, # printi
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
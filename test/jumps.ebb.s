@@ -0,0 +1,36 @@
+.text
+main:
+addiu, $sp, $sp, -12
+# start of extended block - loading into registers
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+li, $t0, 0
+sw, $t0, 4($sp), # store to s
+# begin spilling
+# end of block
+loop:
+# start of extended block - loading into registers
+# variable i is assigned register $t3
+lw, $t3, 0($sp), # load from i
+# variable s is assigned register $t4
+lw, $t4, 4($sp), # load from s
+bge, $t3, 10, exit # if (i >= 10) goto exit
+add, $t4, $t4, $t3
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t4, 4($sp), # store to s
+# end of block
+blt, $t4, 20, loop # if (s < 20) goto loop
+next:
+add, $t4, $t4, 1
+# begin spilling
+sw, $t4, 4($sp), # store to s
+# end of block
+j, loop
+exit:
+move, $a0, $t4, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+addiu, $sp, $sp, 12
+jr, $ra
@@ -0,0 +1,20 @@
+.text
+main:
+# enter main
+# variable i assigned register $t3
+# variable s assigned register $t4
+li, $t3, 0, # store to i
+li, $t4, 0, # store to s
+loop:
+bge, $t3, 10, exit # if (i >= 10) goto exit
+add, $t4, $t4, $t3
+add, $t3, $t3, 1
+blt, $t4, 20, loop # if (s < 20) goto loop
+next:
+add, $t4, $t4, 1
+j, loop
+exit:
+move, $a0, $t4, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+jr, $ra
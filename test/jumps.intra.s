@@ -0,0 +1,43 @@
+.text
+main:
+addiu, $sp, $sp, -12
+# start of block
+li, $t3, 0
+li, $t4, 0
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t4, 4($sp), # store to s
+# end of block
+loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from i
+bge, $t3, 10, exit # if (i >= 10) goto exit
+# start of block
+lw, $t3, 4($sp), # load from s
+lw, $t4, 0($sp), # load from i
+add, $t3, $t3, $t4
+add, $t4, $t4, 1
+# begin spilling
+sw, $t3, 4($sp), # store to s
+sw, $t4, 0($sp), # store to i
+# end of block
+blt, $t3, 20, loop # if (s < 20) goto loop
+next:
+# start of block
+lw, $t3, 4($sp), # load from s
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 4($sp), # store to s
+# end of block
+j, loop
+exit:
+# start of block
+lw, $a0, 4($sp), # load from s
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+addiu, $sp, $sp, 12
+jr, $ra
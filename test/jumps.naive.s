@@ -0,0 +1,30 @@
+.text
+main:
+addiu, $sp, $sp, -12
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+li, $t0, 0
+sw, $t0, 4($sp), # store to s
+loop:
+lw, $t0, 0($sp), # load from i
+bge, $t0, 10, exit # if (i >= 10) goto exit
+lw, $t0, 4($sp), # load from s
+lw, $t1, 0($sp), # load from i
+add, $t2, $t0, $t1
+sw, $t2, 4($sp), # store to s
+lw, $t0, 0($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to i
+lw, $t0, 4($sp), # load from s
+blt, $t0, 20, loop # if (s < 20) goto loop
+next:
+lw, $t0, 4($sp), # load from s
+add, $t2, $t0, 1
+sw, $t2, 4($sp), # store to s
+j, loop
+exit:
+lw, $a0, 4($sp), # load from s
+li, $v0, 1
+syscall, # printi
+addiu, $sp, $sp, 12
+jr, $ra
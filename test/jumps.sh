@@ -0,0 +1,12 @@
+#!/bin/bash
+
+set -e
+
+./phase2 test/jumps.ir $1
+
+diff out.s test/jumps.$1.s
+
+spim -f out.s > tmp
+
+diff tmp test/jumps.out
+
@@ -0,0 +1,53 @@
+.text
+twice_plus:
+addiu, $sp, $sp, -8
+sw, $a0, 0($sp), # store to x
+# start of extended block - loading into registers
+# variable x is assigned register $t3
+lw, $t3, 0($sp), # load from x
+# variable $temp0 is assigned register $t5
+# variable $temp1 is assigned register $t4
+add, $t5, $t3, $t3
+add, $t4, $t5, 1
+move, $v0, $t4, # move of $temp1 to fn arg/ret
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -16
+sw, $ra, 12($sp)
+# start of extended block - loading into registers
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+li, $t0, 0
+sw, $t0, 4($sp), # store to s
+# begin spilling
+# end of block
+loop:
+# start of extended block - loading into registers
+# variable i is assigned register $t3
+lw, $t3, 0($sp), # load from i
+# variable s is assigned register $t4
+lw, $t4, 4($sp), # load from s
+# variable $temp0 is assigned register $t5
+bge, $t3, 10, done # if (i >= 10) goto done
+# spilling for jal
+move, $a0, $t3, # move of i to fn arg/ret
+jal, twice_plus
+# unspilling
+lw, $t3, 0($sp), # load from i
+lw, $t4, 4($sp), # load from s
+move, $t5, $v0
+add, $t4, $t4, $t5
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t4, 4($sp), # store to s
+# end of block
+j, loop
+done:
+move, $a0, $t4, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
@@ -0,0 +1,54 @@
+.text
+twice_plus:
+addiu, $sp, $sp, -8
+sw, $a0, 0($sp), # store to x
+# start of block
+lw, $t3, 0($sp), # load from x
+add, $t4, $t3, $t3
+add, $t5, $t4, 1
+# begin spilling
+# end of block
+move, $v0, $t5, # move of $temp1 to fn arg/ret
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -16
+sw, $ra, 12($sp)
+# start of block
+li, $t3, 0
+li, $t4, 0
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t4, 4($sp), # store to s
+# end of block
+loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from i
+bge, $t3, 10, done # if (i >= 10) goto done
+# start of block
+# spilling for jal
+lw, $a0, 0($sp), # load from i
+jal, twice_plus
+# unspilling
+move, $t3, $v0
+lw, $t4, 4($sp), # load from s
+add, $t4, $t4, $t3
+lw, $t5, 0($sp), # load from i
+add, $t5, $t5, 1
+# begin spilling
+sw, $t4, 4($sp), # store to s
+sw, $t5, 0($sp), # store to i
+# end of block
+j, loop
+done:
+# start of block
+lw, $a0, 4($sp), # load from s
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+lw, $ra, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
@@ -0,0 +1,36 @@
+.text
+twice_plus:
+# enter twice_plus
+# variable x stays in $a0
+# variable $temp1 assigned register $t3
+# variable $temp0 assigned register $t3
+add, $t3, $a0, $a0
+add, $t3, $t3, 1
+move, $v0, $t3, # move of $temp1 to fn arg/ret
+jr, $ra
+main:
+# enter main
+# variable i assigned register $t4
+# variable s assigned register $t5
+# variable $temp0 assigned register $t3
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+li, $t4, 0, # store to i
+li, $t5, 0, # store to s
+loop:
+bge, $t4, 10, done # if (i >= 10) goto done
+# spilling for jal
+move, $a0, $t4, # move of i to fn arg/ret
+jal, twice_plus
+# unspilling
+move, $t3, $v0, # store to $temp0
+add, $t5, $t5, $t3
+add, $t4, $t4, 1
+j, loop
+done:
+move, $a0, $t5, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
@@ -0,0 +1,42 @@
+.text
+twice_plus:
+addiu, $sp, $sp, -8
+sw, $a0, 0($sp), # store to x
+lw, $t0, 0($sp), # load from x
+lw, $t1, 0($sp), # load from x
+add, $t2, $t0, $t1
+sw, $t2, 0($sp), # store to $temp0
+lw, $t0, 0($sp), # load from $temp0
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to $temp1
+lw, $v0, 0($sp), # load from $temp1
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -16
+sw, $ra, 12($sp)
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+li, $t0, 0
+sw, $t0, 4($sp), # store to s
+loop:
+lw, $t0, 0($sp), # load from i
+bge, $t0, 10, done # if (i >= 10) goto done
+lw, $a0, 0($sp), # load from i
+jal, twice_plus
+sw, $v0, 8($sp), # store to $temp0
+lw, $t0, 4($sp), # load from s
+lw, $t1, 8($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 4($sp), # store to s
+lw, $t0, 0($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to i
+j, loop
+done:
+lw, $a0, 4($sp), # load from s
+li, $v0, 1
+syscall, # printi
+lw, $ra, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
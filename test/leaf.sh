@@ -0,0 +1,12 @@
+#!/bin/bash
+
+set -e
+
+./phase2 test/leaf.ir $1
+
+diff out.s test/leaf.$1.s
+
+spim -f out.s > tmp
+
+diff tmp test/leaf.out
+
@@ -0,0 +1,88 @@
+.text
+is_even:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+sw, $a0, 0($sp), # store to n
+# start of extended block - loading into registers
+# variable n is assigned register $t3
+lw, $t3, 0($sp), # load from n
+# variable $temp0 is assigned register $t5
+# variable $temp1 is assigned register $t4
+bne, $t3, 0, even_recurse # if (n != 0) goto even_recurse
+li, $v0, 1
+j, is_even_epilogue
+even_recurse:
+sub, $t5, $t3, 1
+# spilling for jal
+move, $a0, $t5, # move of $temp0 to fn arg/ret
+jal, is_odd
+# unspilling
+move, $t4, $v0
+move, $v0, $t4, # move of $temp1 to fn arg/ret
+is_even_epilogue:
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+is_odd:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+sw, $a0, 0($sp), # store to m
+# start of extended block - loading into registers
+# variable m is assigned register $t3
+lw, $t3, 0($sp), # load from m
+# variable $temp0 is assigned register $t5
+# variable $temp1 is assigned register $t4
+bne, $t3, 0, odd_recurse # if (m != 0) goto odd_recurse
+li, $v0, 0
+j, is_odd_epilogue
+odd_recurse:
+sub, $t5, $t3, 1
+# spilling for jal
+move, $a0, $t5, # move of $temp0 to fn arg/ret
+jal, is_even
+# unspilling
+move, $t4, $v0
+move, $v0, $t4, # move of $temp1 to fn arg/ret
+is_odd_epilogue:
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -16
+sw, $ra, 12($sp)
+# start of extended block - loading into registers
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+li, $t0, 0
+sw, $t0, 4($sp), # store to evens
+# begin spilling
+# end of block
+loop:
+# start of extended block - loading into registers
+# variable i is assigned register $t3
+lw, $t3, 0($sp), # load from i
+# variable evens is assigned register $t4
+lw, $t4, 4($sp), # load from evens
+# variable $temp0 is assigned register $t5
+bge, $t3, 9, done # if (i >= 9) goto done
+# spilling for jal
+move, $a0, $t3, # move of i to fn arg/ret
+jal, is_even
+# unspilling
+lw, $t3, 0($sp), # load from i
+lw, $t4, 4($sp), # load from evens
+move, $t5, $v0
+add, $t4, $t4, $t5
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t4, 4($sp), # store to evens
+# end of block
+j, loop
+done:
+move, $a0, $t4, # move of evens to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
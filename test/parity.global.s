@@ -0,0 +1,63 @@
+.text
+is_even:
+# enter is_even
+# variable n stays in $a0
+# variable $temp0 goes straight to $a0
+# variable $temp1 goes straight to $v0
+bne, $a0, 0, even_recurse # if (n != 0) goto even_recurse
+li, $v0, 1
+jr, $ra
+even_recurse:
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+sub, $a0, $a0, 1
+# spilling for jal
+jal, is_odd
+# unspilling
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
+is_odd:
+# enter is_odd
+# variable m stays in $a0
+# variable $temp0 goes straight to $a0
+# variable $temp1 goes straight to $v0
+bne, $a0, 0, odd_recurse # if (m != 0) goto odd_recurse
+li, $v0, 0
+jr, $ra
+odd_recurse:
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+sub, $a0, $a0, 1
+# spilling for jal
+jal, is_even
+# unspilling
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
+main:
+# enter main
+# variable i assigned register $t3
+# variable evens assigned register $t4
+# variable $temp0 assigned register $t5
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+li, $t3, 0, # store to i
+li, $t4, 0, # store to evens
+loop:
+bge, $t3, 9, done # if (i >= 9) goto done
+# spilling for jal
+move, $a0, $t3, # move of i to fn arg/ret
+jal, is_even
+# unspilling
+move, $t5, $v0, # store to $temp0
+add, $t4, $t4, $t5
+add, $t3, $t3, 1
+j, loop
+done:
+move, $a0, $t4, # move of evens to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
@@ -0,0 +1,102 @@
+.text
+is_even:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+sw, $a0, 0($sp), # store to n
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from n
+bne, $t3, 0, even_recurse # if (n != 0) goto even_recurse
+# start of block
+# begin spilling
+# end of block
+li, $v0, 1
+j, is_even_epilogue
+even_recurse:
+# start of block
+lw, $t3, 0($sp), # load from n
+sub, $t4, $t3, 1
+# spilling for jal
+move, $a0, $t4, # move of $temp0 to fn arg/ret
+jal, is_odd
+# unspilling
+move, $t3, $v0
+# begin spilling
+# end of block
+move, $v0, $t3, # move of $temp1 to fn arg/ret
+is_even_epilogue:
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+is_odd:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+sw, $a0, 0($sp), # store to m
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from m
+bne, $t3, 0, odd_recurse # if (m != 0) goto odd_recurse
+# start of block
+# begin spilling
+# end of block
+li, $v0, 0
+j, is_odd_epilogue
+odd_recurse:
+# start of block
+lw, $t3, 0($sp), # load from m
+sub, $t4, $t3, 1
+# spilling for jal
+move, $a0, $t4, # move of $temp0 to fn arg/ret
+jal, is_even
+# unspilling
+move, $t3, $v0
+# begin spilling
+# end of block
+move, $v0, $t3, # move of $temp1 to fn arg/ret
+is_odd_epilogue:
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -16
+sw, $ra, 12($sp)
+# start of block
+li, $t3, 0
+li, $t4, 0
+# begin spilling
+sw, $t3, 0($sp), # store to i
+sw, $t4, 4($sp), # store to evens
+# end of block
+loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 0($sp), # load from i
+bge, $t3, 9, done # if (i >= 9) goto done
+# start of block
+# spilling for jal
+lw, $a0, 0($sp), # load from i
+jal, is_even
+# unspilling
+move, $t3, $v0
+lw, $t4, 4($sp), # load from evens
+add, $t4, $t4, $t3
+lw, $t5, 0($sp), # load from i
+add, $t5, $t5, 1
+# begin spilling
+sw, $t4, 4($sp), # store to evens
+sw, $t5, 0($sp), # store to i
+# end of block
+j, loop
+done:
+# start of block
+lw, $a0, 4($sp), # load from evens
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+lw, $ra, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
@@ -0,0 +1,69 @@
+.text
+is_even:
+# enter is_even
+# variable n stays in $a0
+# variable $temp1 assigned register $t3
+# variable $temp0 assigned register $t3
+bne, $a0, 0, even_recurse # if (n != 0) goto even_recurse
+li, $v0, 1
+jr, $ra
+even_recurse:
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+sub, $t3, $a0, 1
+# spilling for jal
+move, $a0, $t3, # move of $temp0 to fn arg/ret
+jal, is_odd
+# unspilling
+move, $t3, $v0, # store to $temp1
+move, $v0, $t3, # move of $temp1 to fn arg/ret
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
+is_odd:
+# enter is_odd
+# variable m stays in $a0
+# variable $temp1 assigned register $t3
+# variable $temp0 assigned register $t3
+bne, $a0, 0, odd_recurse # if (m != 0) goto odd_recurse
+li, $v0, 0
+jr, $ra
+odd_recurse:
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+sub, $t3, $a0, 1
+# spilling for jal
+move, $a0, $t3, # move of $temp0 to fn arg/ret
+jal, is_even
+# unspilling
+move, $t3, $v0, # store to $temp1
+move, $v0, $t3, # move of $temp1 to fn arg/ret
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
+main:
+# enter main
+# variable i assigned register $t4
+# variable evens assigned register $t5
+# variable $temp0 assigned register $t3
+addiu, $sp, $sp, -4
+sw, $ra, 0($sp)
+li, $t4, 0, # store to i
+li, $t5, 0, # store to evens
+loop:
+bge, $t4, 9, done # if (i >= 9) goto done
+# spilling for jal
+move, $a0, $t4, # move of i to fn arg/ret
+jal, is_even
+# unspilling
+move, $t3, $v0, # store to $temp0
+add, $t5, $t5, $t3
+add, $t4, $t4, 1
+j, loop
+done:
+move, $a0, $t5, # move of evens to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $ra, 0($sp)
+addiu, $sp, $sp, 4
+jr, $ra
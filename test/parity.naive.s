@@ -0,0 +1,69 @@
+.text
+is_even:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+sw, $a0, 0($sp), # store to n
+lw, $t0, 0($sp), # load from n
+bne, $t0, 0, even_recurse # if (n != 0) goto even_recurse
+li, $v0, 1
+j, is_even_epilogue
+even_recurse:
+lw, $t0, 0($sp), # load from n
+sub, $t2, $t0, 1
+sw, $t2, 0($sp), # store to $temp0
+lw, $a0, 0($sp), # load from $temp0
+jal, is_odd
+sw, $v0, 0($sp), # store to $temp1
+lw, $v0, 0($sp), # load from $temp1
+is_even_epilogue:
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+is_odd:
+addiu, $sp, $sp, -8
+sw, $ra, 4($sp)
+sw, $a0, 0($sp), # store to m
+lw, $t0, 0($sp), # load from m
+bne, $t0, 0, odd_recurse # if (m != 0) goto odd_recurse
+li, $v0, 0
+j, is_odd_epilogue
+odd_recurse:
+lw, $t0, 0($sp), # load from m
+sub, $t2, $t0, 1
+sw, $t2, 0($sp), # store to $temp0
+lw, $a0, 0($sp), # load from $temp0
+jal, is_even
+sw, $v0, 0($sp), # store to $temp1
+lw, $v0, 0($sp), # load from $temp1
+is_odd_epilogue:
+lw, $ra, 4($sp)
+addiu, $sp, $sp, 8
+jr, $ra
+main:
+addiu, $sp, $sp, -16
+sw, $ra, 12($sp)
+li, $t0, 0
+sw, $t0, 0($sp), # store to i
+li, $t0, 0
+sw, $t0, 4($sp), # store to evens
+loop:
+lw, $t0, 0($sp), # load from i
+bge, $t0, 9, done # if (i >= 9) goto done
+lw, $a0, 0($sp), # load from i
+jal, is_even
+sw, $v0, 8($sp), # store to $temp0
+lw, $t0, 4($sp), # load from evens
+lw, $t1, 8($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 4($sp), # store to evens
+lw, $t0, 0($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to i
+j, loop
+done:
+lw, $a0, 4($sp), # load from evens
+li, $v0, 1
+syscall, # printi
+lw, $ra, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
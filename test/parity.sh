@@ -0,0 +1,12 @@
+#!/bin/bash
+
+set -e
+
+./phase2 test/parity.ir $1
+
+diff out.s test/parity.$1.s
+
+spim -f out.s > tmp
+
+diff tmp test/parity.out
+
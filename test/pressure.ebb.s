@@ -0,0 +1,51 @@
+.text
+main:
+addiu, $sp, $sp, -20
+# start of extended block - loading into registers
+li, $t0, 1
+sw, $t0, 0($sp), # store to a
+li, $t0, 10
+sw, $t0, 4($sp), # store to m
+li, $t0, 0
+sw, $t0, 8($sp), # store to i
+li, $t0, 0
+sw, $t0, 12($sp), # store to s
+# begin spilling
+# end of block
+loop:
+# start of extended block - loading into registers
+# variable a is assigned register $t4
+lw, $t4, 0($sp), # load from a
+# variable m is assigned register $t6
+lw, $t6, 4($sp), # load from m
+# variable i is assigned register $t5
+lw, $t5, 8($sp), # load from i
+# variable s is assigned register $t3
+lw, $t3, 12($sp), # load from s
+bge, $t5, 10, done # if (i >= 10) goto done
+add, $t3, $t3, $t4
+add, $t3, $t3, 2
+add, $t3, $t3, 3
+add, $t3, $t3, 4
+add, $t3, $t3, 5
+add, $t3, $t3, 6
+add, $t3, $t3, 7
+add, $t3, $t3, 8
+add, $t3, $t3, 9
+add, $t3, $t3, $t6
+add, $t4, $t4, 1
+add, $t6, $t6, $t4
+add, $t5, $t5, 1
+# begin spilling
+sw, $t4, 0($sp), # store to a
+sw, $t6, 4($sp), # store to m
+sw, $t5, 8($sp), # store to i
+sw, $t3, 12($sp), # store to s
+# end of block
+j, loop
+done:
+move, $a0, $t3, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+addiu, $sp, $sp, 20
+jr, $ra
@@ -0,0 +1,45 @@
+.text
+main:
+# enter main
+# variable a assigned register $t4
+# variable m assigned register $t5
+# variable i assigned register $s0
+# variable s assigned register $t3
+# variable $s.26 assigned register $t3
+# variable $s.27 assigned register $t3
+# variable $s.28 assigned register $t3
+# variable $s.29 assigned register $t3
+# variable $s.30 assigned register $t3
+# variable $s.31 assigned register $t3
+# variable $s.32 assigned register $t3
+# variable $s.33 assigned register $t3
+# variable $s.34 assigned register $t3
+addiu, $sp, $sp, -12
+sw, $s0, 8($sp)
+li, $t4, 1, # store to a
+li, $t5, 10, # store to m
+li, $s0, 0, # store to i
+li, $t3, 0, # store to s
+loop:
+bge, $s0, 10, done # if (i >= 10) goto done
+add, $t3, $t3, $t4
+add, $t3, $t3, 2
+add, $t3, $t3, 3
+add, $t3, $t3, 4
+add, $t3, $t3, 5
+add, $t3, $t3, 6
+add, $t3, $t3, 7
+add, $t3, $t3, 8
+add, $t3, $t3, 9
+add, $t3, $t3, $t5
+add, $t4, $t4, 1
+add, $t5, $t5, $t4
+add, $s0, $s0, 1
+j, loop
+done:
+move, $a0, $t3, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $s0, 8($sp)
+addiu, $sp, $sp, 12
+jr, $ra
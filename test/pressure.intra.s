@@ -0,0 +1,54 @@
+.text
+main:
+addiu, $sp, $sp, -20
+# start of block
+li, $t3, 1
+li, $t4, 10
+li, $t5, 0
+li, $t6, 0
+# begin spilling
+sw, $t3, 0($sp), # store to a
+sw, $t4, 4($sp), # store to m
+sw, $t5, 8($sp), # store to i
+sw, $t6, 12($sp), # store to s
+# end of block
+loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 8($sp), # load from i
+bge, $t3, 10, done # if (i >= 10) goto done
+# start of block
+lw, $t3, 12($sp), # load from s
+lw, $t4, 0($sp), # load from a
+add, $t3, $t3, $t4
+add, $t3, $t3, 2
+add, $t3, $t3, 3
+add, $t3, $t3, 4
+add, $t3, $t3, 5
+add, $t3, $t3, 6
+add, $t3, $t3, 7
+add, $t3, $t3, 8
+add, $t3, $t3, 9
+lw, $t5, 4($sp), # load from m
+add, $t3, $t3, $t5
+add, $t4, $t4, 1
+add, $t5, $t5, $t4
+lw, $t6, 8($sp), # load from i
+add, $t6, $t6, 1
+# begin spilling
+sw, $t3, 12($sp), # store to s
+sw, $t4, 0($sp), # store to a
+sw, $t5, 4($sp), # store to m
+sw, $t6, 8($sp), # store to i
+# end of block
+j, loop
+done:
+# start of block
+lw, $a0, 12($sp), # load from s
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+addiu, $sp, $sp, 20
+jr, $ra
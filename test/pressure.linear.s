@@ -0,0 +1,32 @@
+.text
+main:
+# enter main
+# variable a assigned register $t3
+# variable m assigned register $t4
+# variable i assigned register $t5
+# variable s assigned register $t6
+li, $t3, 1, # store to a
+li, $t4, 10, # store to m
+li, $t5, 0, # store to i
+li, $t6, 0, # store to s
+loop:
+bge, $t5, 10, done # if (i >= 10) goto done
+add, $t6, $t6, $t3
+add, $t6, $t6, 2
+add, $t6, $t6, 3
+add, $t6, $t6, 4
+add, $t6, $t6, 5
+add, $t6, $t6, 6
+add, $t6, $t6, 7
+add, $t6, $t6, 8
+add, $t6, $t6, 9
+add, $t6, $t6, $t4
+add, $t3, $t3, 1
+add, $t4, $t4, $t3
+add, $t5, $t5, 1
+j, loop
+done:
+move, $a0, $t6, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+jr, $ra
@@ -0,0 +1,36 @@
+.text
+main:
+# enter main
+# variable a assigned register $t3
+# variable m assigned register $t4
+# variable i assigned register $t5
+# variable s assigned register $s0
+addiu, $sp, $sp, -12
+sw, $s0, 8($sp)
+li, $t3, 1, # store to a
+li, $t4, 10, # store to m
+li, $t5, 0, # store to i
+li, $s0, 0, # store to s
+loop:
+bge, $t5, 10, done # if (i >= 10) goto done
+add, $s0, $s0, $t3
+add, $s0, $s0, 2
+add, $s0, $s0, 3
+add, $s0, $s0, 4
+add, $s0, $s0, 5
+add, $s0, $s0, 6
+add, $s0, $s0, 7
+add, $s0, $s0, 8
+add, $s0, $s0, 9
+add, $s0, $s0, $t4
+add, $t3, $t3, 1
+add, $t4, $t4, $t3
+add, $t5, $t5, 1
+j, loop
+done:
+move, $a0, $s0, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $s0, 8($sp)
+addiu, $sp, $sp, 12
+jr, $ra
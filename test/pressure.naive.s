@@ -0,0 +1,87 @@
+.text
+main:
+addiu, $sp, $sp, -52
+li, $t0, 1
+sw, $t0, 0($sp), # store to a
+li, $t0, 2
+sw, $t0, 4($sp), # store to b
+li, $t0, 3
+sw, $t0, 8($sp), # store to c
+li, $t0, 4
+sw, $t0, 12($sp), # store to d
+li, $t0, 5
+sw, $t0, 16($sp), # store to e
+li, $t0, 6
+sw, $t0, 20($sp), # store to f
+li, $t0, 7
+sw, $t0, 24($sp), # store to g
+li, $t0, 8
+sw, $t0, 28($sp), # store to h
+li, $t0, 9
+sw, $t0, 32($sp), # store to k
+li, $t0, 10
+sw, $t0, 36($sp), # store to m
+li, $t0, 0
+sw, $t0, 40($sp), # store to i
+li, $t0, 0
+sw, $t0, 44($sp), # store to s
+loop:
+lw, $t0, 40($sp), # load from i
+bge, $t0, 10, done # if (i >= 10) goto done
+lw, $t0, 44($sp), # load from s
+lw, $t1, 0($sp), # load from a
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 4($sp), # load from b
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 8($sp), # load from c
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 12($sp), # load from d
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 16($sp), # load from e
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 20($sp), # load from f
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 24($sp), # load from g
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 28($sp), # load from h
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 32($sp), # load from k
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 44($sp), # load from s
+lw, $t1, 36($sp), # load from m
+add, $t2, $t0, $t1
+sw, $t2, 44($sp), # store to s
+lw, $t0, 0($sp), # load from a
+add, $t2, $t0, 1
+sw, $t2, 0($sp), # store to a
+lw, $t0, 36($sp), # load from m
+lw, $t1, 0($sp), # load from a
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to m
+lw, $t0, 40($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 40($sp), # store to i
+j, loop
+done:
+lw, $a0, 44($sp), # load from s
+li, $v0, 1
+syscall, # printi
+addiu, $sp, $sp, 52
+jr, $ra
@@ -0,0 +1,12 @@
+#!/bin/bash
+
+set -e
+
+# optional second argument: number of registers to allocate
+./phase2 test/pressure.ir $1 $2
+
+diff out.s test/pressure.$1$2.s
+
+spim -f out.s > tmp
+
+diff tmp test/pressure.out
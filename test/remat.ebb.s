@@ -0,0 +1,84 @@
+.text
+main:
+addiu, $sp, $sp, -60
+sw, $s0, 48($sp)
+sw, $s1, 52($sp)
+sw, $s2, 56($sp)
+# start of extended block - loading into registers
+li, $t0, 100
+sw, $t0, 0($sp), # store to c1
+li, $t0, 200
+sw, $t0, 4($sp), # store to c2
+li, $t0, 300
+sw, $t0, 8($sp), # store to c3
+li, $t0, 400
+sw, $t0, 12($sp), # store to c4
+li, $t0, 500
+sw, $t0, 16($sp), # store to c5
+li, $t0, 600
+sw, $t0, 20($sp), # store to c6
+li, $t0, 700
+sw, $t0, 24($sp), # store to c7
+li, $t0, 800
+sw, $t0, 28($sp), # store to c8
+li, $t0, 0
+sw, $t0, 32($sp), # store to i
+li, $t0, 0
+sw, $t0, 36($sp), # store to s
+# begin spilling
+# end of block
+loop:
+# start of extended block - loading into registers
+# variable c1 is assigned register $s2
+lw, $s2, 0($sp), # load from c1
+# variable c2 is assigned register $s1
+lw, $s1, 4($sp), # load from c2
+# variable c3 is assigned register $s0
+lw, $s0, 8($sp), # load from c3
+# variable c4 is assigned register $v1
+lw, $v1, 12($sp), # load from c4
+# variable c5 is assigned register $t9
+lw, $t9, 16($sp), # load from c5
+# variable c6 is assigned register $t8
+lw, $t8, 20($sp), # load from c6
+# variable c7 is assigned register $t7
+lw, $t7, 24($sp), # load from c7
+# variable c8 is assigned register $t6
+lw, $t6, 28($sp), # load from c8
+# variable i is assigned register $t3
+lw, $t3, 32($sp), # load from i
+# variable s is assigned register $t4
+lw, $t4, 36($sp), # load from s
+# variable $temp0 is assigned register $t5
+bge, $t3, 10, done # if (i >= 10) goto done
+sub, $t5, $s2, $t3
+add, $t4, $t4, $t5
+sub, $t5, $s1, $t3
+add, $t4, $t4, $t5
+sub, $t5, $s0, $t3
+add, $t4, $t4, $t5
+sub, $t5, $v1, $t3
+add, $t4, $t4, $t5
+sub, $t5, $t9, $t3
+add, $t4, $t4, $t5
+sub, $t5, $t8, $t3
+add, $t4, $t4, $t5
+sub, $t5, $t7, $t3
+add, $t4, $t4, $t5
+sub, $t5, $t6, $t3
+add, $t4, $t4, $t5
+add, $t3, $t3, 1
+# begin spilling
+sw, $t3, 32($sp), # store to i
+sw, $t4, 36($sp), # store to s
+# end of block
+j, loop
+done:
+move, $a0, $t4, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $s0, 48($sp)
+lw, $s1, 52($sp)
+lw, $s2, 56($sp)
+addiu, $sp, $sp, 60
+jr, $ra
@@ -0,0 +1,71 @@
+.text
+main:
+# enter main
+# variable c1 assigned register $t5
+# variable c2 assigned register $t6
+# variable c3 assigned register $t7
+# variable c4 assigned register $t8
+# variable c5 assigned register $t9
+# variable c6 assigned register $v1
+# variable c7 assigned register $s0
+# variable c8 assigned register $s1
+# variable i assigned register $s2
+# variable s assigned register $t3
+# variable $temp0 assigned register $t4
+# variable $s.25 assigned register $t3
+# variable $temp0.26 assigned register $t4
+# variable $s.27 assigned register $t3
+# variable $temp0.28 assigned register $t4
+# variable $s.29 assigned register $t3
+# variable $temp0.30 assigned register $t4
+# variable $s.31 assigned register $t3
+# variable $temp0.32 assigned register $t4
+# variable $s.33 assigned register $t3
+# variable $temp0.34 assigned register $t4
+# variable $s.35 assigned register $t3
+# variable $temp0.36 assigned register $t4
+# variable $s.37 assigned register $t3
+# variable $temp0.38 assigned register $t4
+addiu, $sp, $sp, -16
+sw, $s0, 4($sp)
+sw, $s1, 8($sp)
+sw, $s2, 12($sp)
+li, $t5, 100, # store to c1
+li, $t6, 200, # store to c2
+li, $t7, 300, # store to c3
+li, $t8, 400, # store to c4
+li, $t9, 500, # store to c5
+li, $v1, 600, # store to c6
+li, $s0, 700, # store to c7
+li, $s1, 800, # store to c8
+li, $s2, 0, # store to i
+li, $t3, 0, # store to s
+loop:
+bge, $s2, 10, done # if (i >= 10) goto done
+sub, $t4, $t5, $s2
+add, $t3, $t3, $t4
+sub, $t4, $t6, $s2
+add, $t3, $t3, $t4
+sub, $t4, $t7, $s2
+add, $t3, $t3, $t4
+sub, $t4, $t8, $s2
+add, $t3, $t3, $t4
+sub, $t4, $t9, $s2
+add, $t3, $t3, $t4
+sub, $t4, $v1, $s2
+add, $t3, $t3, $t4
+sub, $t4, $s0, $s2
+add, $t3, $t3, $t4
+sub, $t4, $s1, $s2
+add, $t3, $t3, $t4
+add, $s2, $s2, 1
+j, loop
+done:
+move, $a0, $t3, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $s0, 4($sp)
+lw, $s1, 8($sp)
+lw, $s2, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
@@ -0,0 +1,76 @@
+.text
+main:
+# enter main
+# variable c6 assigned register $t5
+# variable c7 assigned register $s0
+# variable c8 assigned register $s1
+# variable i assigned register $s2
+# variable s assigned register $t4
+# variable $temp0 assigned register $t3
+# variable $s.25 assigned register $t4
+# variable $temp0.26 assigned register $t3
+# variable $s.27 assigned register $t4
+# variable $temp0.28 assigned register $t3
+# variable $s.29 assigned register $t4
+# variable $temp0.30 assigned register $t3
+# variable $s.31 assigned register $t4
+# variable $temp0.32 assigned register $t3
+# variable $s.33 assigned register $t3
+# variable $temp0.34 assigned register $t4
+# variable $s.35 assigned register $t3
+# variable $temp0.36 assigned register $t4
+# variable $s.37 assigned register $t3
+# variable $temp0.38 assigned register $t4
+# variable $spill.39 assigned register $t3
+# variable $spill.40 assigned register $t3
+# variable $spill.41 assigned register $t3
+# variable $spill.42 assigned register $t3
+# variable $spill.43 assigned register $t3
+# variable c1 is rematerialized
+# variable c2 is rematerialized
+# variable c3 is rematerialized
+# variable c4 is rematerialized
+# variable c5 is rematerialized
+addiu, $sp, $sp, -16
+sw, $s0, 4($sp)
+sw, $s1, 8($sp)
+sw, $s2, 12($sp)
+li, $t5, 600, # store to c6
+li, $s0, 700, # store to c7
+li, $s1, 800, # store to c8
+li, $s2, 0, # store to i
+li, $t4, 0, # store to s
+loop:
+bge, $s2, 10, done # if (i >= 10) goto done
+li, $t3, 100, # store to $spill.39
+sub, $t3, $t3, $s2
+add, $t4, $t4, $t3
+li, $t3, 200, # store to $spill.40
+sub, $t3, $t3, $s2
+add, $t4, $t4, $t3
+li, $t3, 300, # store to $spill.41
+sub, $t3, $t3, $s2
+add, $t4, $t4, $t3
+li, $t3, 400, # store to $spill.42
+sub, $t3, $t3, $s2
+add, $t4, $t4, $t3
+li, $t3, 500, # store to $spill.43
+sub, $t3, $t3, $s2
+add, $t3, $t4, $t3
+sub, $t4, $t5, $s2
+add, $t3, $t3, $t4
+sub, $t4, $s0, $s2
+add, $t3, $t3, $t4
+sub, $t4, $s1, $s2
+add, $t4, $t3, $t4
+add, $s2, $s2, 1
+j, loop
+done:
+move, $a0, $t4, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $s0, 4($sp)
+lw, $s1, 8($sp)
+lw, $s2, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
@@ -0,0 +1,80 @@
+.text
+main:
+addiu, $sp, $sp, -60
+sw, $s0, 48($sp)
+sw, $s1, 52($sp)
+sw, $s2, 56($sp)
+# start of block
+li, $t3, 100
+li, $t4, 200
+li, $t5, 300
+li, $t6, 400
+li, $t7, 500
+li, $t8, 600
+li, $t9, 700
+li, $v1, 800
+li, $s0, 0
+li, $s1, 0
+# begin spilling
+sw, $t3, 0($sp), # store to c1
+sw, $t4, 4($sp), # store to c2
+sw, $t5, 8($sp), # store to c3
+sw, $t6, 12($sp), # store to c4
+sw, $t7, 16($sp), # store to c5
+sw, $t8, 20($sp), # store to c6
+sw, $t9, 24($sp), # store to c7
+sw, $v1, 28($sp), # store to c8
+sw, $s0, 32($sp), # store to i
+sw, $s1, 36($sp), # store to s
+# end of block
+loop:
+# start of block
+# begin spilling
+# end of block
+lw, $t3, 32($sp), # load from i
+bge, $t3, 10, done # if (i >= 10) goto done
+# start of block
+lw, $t3, 0($sp), # load from c1
+lw, $t4, 32($sp), # load from i
+sub, $t5, $t3, $t4
+lw, $t6, 36($sp), # load from s
+add, $t6, $t6, $t5
+lw, $t7, 4($sp), # load from c2
+sub, $t5, $t7, $t4
+add, $t6, $t6, $t5
+lw, $t8, 8($sp), # load from c3
+sub, $t5, $t8, $t4
+add, $t6, $t6, $t5
+lw, $t9, 12($sp), # load from c4
+sub, $t5, $t9, $t4
+add, $t6, $t6, $t5
+lw, $v1, 16($sp), # load from c5
+sub, $t5, $v1, $t4
+add, $t6, $t6, $t5
+lw, $s0, 20($sp), # load from c6
+sub, $t5, $s0, $t4
+add, $t6, $t6, $t5
+lw, $s1, 24($sp), # load from c7
+sub, $t5, $s1, $t4
+add, $t6, $t6, $t5
+lw, $s2, 28($sp), # load from c8
+sub, $t5, $s2, $t4
+add, $t6, $t6, $t5
+add, $t4, $t4, 1
+# begin spilling
+sw, $t4, 32($sp), # store to i
+sw, $t6, 36($sp), # store to s
+# end of block
+j, loop
+done:
+# start of block
+lw, $a0, 36($sp), # load from s
+li, $v0, 1
+syscall, # printi
+# begin spilling
+# end of block
+lw, $s0, 48($sp)
+lw, $s1, 52($sp)
+lw, $s2, 56($sp)
+addiu, $sp, $sp, 60
+jr, $ra
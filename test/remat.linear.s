@@ -0,0 +1,57 @@
+.text
+main:
+# enter main
+# variable c1 assigned register $t3
+# variable c2 assigned register $t4
+# variable c3 assigned register $t5
+# variable c4 assigned register $t6
+# variable c5 assigned register $t7
+# variable c6 assigned register $t8
+# variable c7 assigned register $t9
+# variable c8 assigned register $v1
+# variable i assigned register $s0
+# variable s assigned register $s1
+# variable $temp0 assigned register $s2
+addiu, $sp, $sp, -16
+sw, $s0, 4($sp)
+sw, $s1, 8($sp)
+sw, $s2, 12($sp)
+li, $t3, 100, # store to c1
+li, $t4, 200, # store to c2
+li, $t5, 300, # store to c3
+li, $t6, 400, # store to c4
+li, $t7, 500, # store to c5
+li, $t8, 600, # store to c6
+li, $t9, 700, # store to c7
+li, $v1, 800, # store to c8
+li, $s0, 0, # store to i
+li, $s1, 0, # store to s
+loop:
+bge, $s0, 10, done # if (i >= 10) goto done
+sub, $s2, $t3, $s0
+add, $s1, $s1, $s2
+sub, $s2, $t4, $s0
+add, $s1, $s1, $s2
+sub, $s2, $t5, $s0
+add, $s1, $s1, $s2
+sub, $s2, $t6, $s0
+add, $s1, $s1, $s2
+sub, $s2, $t7, $s0
+add, $s1, $s1, $s2
+sub, $s2, $t8, $s0
+add, $s1, $s1, $s2
+sub, $s2, $t9, $s0
+add, $s1, $s1, $s2
+sub, $s2, $v1, $s0
+add, $s1, $s1, $s2
+add, $s0, $s0, 1
+j, loop
+done:
+move, $a0, $s1, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $s0, 4($sp)
+lw, $s1, 8($sp)
+lw, $s2, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
@@ -0,0 +1,57 @@
+.text
+main:
+# enter main
+# variable c1 is rematerialized
+# variable c2 is rematerialized
+# variable c3 is rematerialized
+# variable c4 is rematerialized
+# variable c5 is rematerialized
+# variable c6 assigned register $s2
+# variable c7 assigned register $t3
+# variable c8 assigned register $t4
+# variable i assigned register $t5
+# variable s assigned register $s0
+# variable $temp0 assigned register $s1
+addiu, $sp, $sp, -16
+sw, $s0, 4($sp)
+sw, $s1, 8($sp)
+sw, $s2, 12($sp)
+li, $s2, 600, # store to c6
+li, $t3, 700, # store to c7
+li, $t4, 800, # store to c8
+li, $t5, 0, # store to i
+li, $s0, 0, # store to s
+loop:
+bge, $t5, 10, done # if (i >= 10) goto done
+li, $t0, 100, # rematerialize c1
+sub, $s1, $t0, $t5
+add, $s0, $s0, $s1
+li, $t0, 200, # rematerialize c2
+sub, $s1, $t0, $t5
+add, $s0, $s0, $s1
+li, $t0, 300, # rematerialize c3
+sub, $s1, $t0, $t5
+add, $s0, $s0, $s1
+li, $t0, 400, # rematerialize c4
+sub, $s1, $t0, $t5
+add, $s0, $s0, $s1
+li, $t0, 500, # rematerialize c5
+sub, $s1, $t0, $t5
+add, $s0, $s0, $s1
+sub, $s1, $s2, $t5
+add, $s0, $s0, $s1
+sub, $s1, $t3, $t5
+add, $s0, $s0, $s1
+sub, $s1, $t4, $t5
+add, $s0, $s0, $s1
+add, $t5, $t5, 1
+j, loop
+done:
+move, $a0, $s0, # move of s to fn arg/ret
+li, $v0, 1
+syscall, # printi
+lw, $s0, 4($sp)
+lw, $s1, 8($sp)
+lw, $s2, 12($sp)
+addiu, $sp, $sp, 16
+jr, $ra
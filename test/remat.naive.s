@@ -0,0 +1,100 @@
+.text
+main:
+addiu, $sp, $sp, -48
+li, $t0, 100
+sw, $t0, 0($sp), # store to c1
+li, $t0, 200
+sw, $t0, 4($sp), # store to c2
+li, $t0, 300
+sw, $t0, 8($sp), # store to c3
+li, $t0, 400
+sw, $t0, 12($sp), # store to c4
+li, $t0, 500
+sw, $t0, 16($sp), # store to c5
+li, $t0, 600
+sw, $t0, 20($sp), # store to c6
+li, $t0, 700
+sw, $t0, 24($sp), # store to c7
+li, $t0, 800
+sw, $t0, 28($sp), # store to c8
+li, $t0, 0
+sw, $t0, 32($sp), # store to i
+li, $t0, 0
+sw, $t0, 36($sp), # store to s
+loop:
+lw, $t0, 32($sp), # load from i
+bge, $t0, 10, done # if (i >= 10) goto done
+lw, $t0, 0($sp), # load from c1
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 4($sp), # load from c2
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 8($sp), # load from c3
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 12($sp), # load from c4
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 16($sp), # load from c5
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 20($sp), # load from c6
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 24($sp), # load from c7
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 28($sp), # load from c8
+lw, $t1, 32($sp), # load from i
+sub, $t2, $t0, $t1
+sw, $t2, 40($sp), # store to $temp0
+lw, $t0, 36($sp), # load from s
+lw, $t1, 40($sp), # load from $temp0
+add, $t2, $t0, $t1
+sw, $t2, 36($sp), # store to s
+lw, $t0, 32($sp), # load from i
+add, $t2, $t0, 1
+sw, $t2, 32($sp), # store to i
+j, loop
+done:
+lw, $a0, 36($sp), # load from s
+li, $v0, 1
+syscall, # printi
+addiu, $sp, $sp, 48
+jr, $ra